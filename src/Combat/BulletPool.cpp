@@ -0,0 +1,90 @@
+/**
+ * @file BulletPool.cpp
+ * @brief Implementation of the fixed-capacity bullet pool
+ * @details Advances, culls and resolves collisions for all bullets in
+ *          a single pass over preallocated arrays.
+ */
+
+#include "BulletPool.h"
+#include <cstddef>
+
+/**
+ * @brief Constructor for BulletPool
+ * Allocates all storage up front
+ * @param capacity Maximum number of bullets in flight at once
+ */
+BulletPool::BulletPool(int capacity)
+    : bulletX(static_cast<size_t>(capacity)),
+      bulletY(static_cast<size_t>(capacity)),
+      count(0) {}
+
+/**
+ * @brief Adds a bullet
+ * @param x Initial X coordinate
+ * @param y Initial Y coordinate
+ * @return true if the bullet was added, false if the pool is full
+ */
+bool BulletPool::fire(int x, int y) {
+    if (count == static_cast<int>(bulletX.size())) {
+        return false;
+    }
+    bulletX[count] = x;
+    bulletY[count] = y;
+    count++;
+    return true;
+}
+
+/**
+ * @brief Moves every bullet up one row and resolves its collisions
+ * A removed slot is refilled from the end of the pool and examined
+ * again, so each bullet is advanced exactly once
+ * @param zombieManager Zombies the bullets can hit
+ * @param damage Damage dealt by each bullet
+ */
+void BulletPool::advance(ZombieManager& zombieManager, int damage) {
+    int i = 0;
+    while (i < count) {
+        bulletY[i]--;
+        if (bulletY[i] < 0 || zombieManager.processCollision(bulletX[i], bulletY[i], damage) > 0) {
+            remove(i);
+        } else {
+            i++;
+        }
+    }
+}
+
+/**
+ * @brief Removes a bullet by moving the last one into its slot
+ * @param index Index of the bullet to remove
+ */
+void BulletPool::remove(int index) {
+    count--;
+    bulletX[index] = bulletX[count];
+    bulletY[index] = bulletY[count];
+}
+
+/**
+ * @brief Gets the number of bullets in flight
+ * @return Number of bullets
+ */
+int BulletPool::getCount() const {
+    return count;
+}
+
+/**
+ * @brief Gets the X coordinate of a bullet
+ * @param index Index between 0 and getCount() - 1
+ * @return X coordinate
+ */
+int BulletPool::getX(int index) const {
+    return bulletX[index];
+}
+
+/**
+ * @brief Gets the Y coordinate of a bullet
+ * @param index Index between 0 and getCount() - 1
+ * @return Y coordinate
+ */
+int BulletPool::getY(int index) const {
+    return bulletY[index];
+}
@@ -0,0 +1,80 @@
+/**
+ * @file BulletPool.h
+ * @brief Fixed-capacity storage for the bullets in flight
+ * 
+ * This file defines the BulletPool class, which holds every bullet the
+ * player has fired and not yet lost. Its storage is allocated once when
+ * combat starts, so firing never touches the heap. It provides:
+ * - Firing into a free slot, dropping the bullet if the pool is full
+ * - One linear pass per tick that advances every bullet, culls those
+ *   that left the arena and resolves their collisions with zombies
+ * 
+ * @see Combat
+ * @see ZombieManager
+ */
+
+#pragma once
+#include "Zombie.h"
+#include <vector>
+
+/**
+ * @class BulletPool
+ * @brief Bullet positions stored as parallel arrays of fixed capacity
+ */
+class BulletPool {
+private:
+    std::vector<int> bulletX;   // X coordinates, valid below count
+    std::vector<int> bulletY;   // Y coordinates, valid below count
+    int count;                  // Number of bullets in flight
+    
+    /**
+     * @brief Removes a bullet by moving the last one into its slot
+     * @param index Index of the bullet to remove
+     */
+    void remove(int index);
+    
+public:
+    /**
+     * @brief Constructor for BulletPool
+     * @param capacity Maximum number of bullets in flight at once
+     */
+    explicit BulletPool(int capacity);
+    
+    /**
+     * @brief Adds a bullet
+     * @param x Initial X coordinate
+     * @param y Initial Y coordinate
+     * @return true if the bullet was added, false if the pool is full
+     */
+    bool fire(int x, int y);
+    
+    /**
+     * @brief Moves every bullet up one row and resolves its collisions
+     * 
+     * Bullets that leave the top of the arena or hit a zombie are removed
+     * in the same pass.
+     * @param zombieManager Zombies the bullets can hit
+     * @param damage Damage dealt by each bullet
+     */
+    void advance(ZombieManager& zombieManager, int damage);
+    
+    /**
+     * @brief Gets the number of bullets in flight
+     * @return Number of bullets
+     */
+    int getCount() const;
+    
+    /**
+     * @brief Gets the X coordinate of a bullet
+     * @param index Index between 0 and getCount() - 1
+     * @return X coordinate
+     */
+    int getX(int index) const;
+    
+    /**
+     * @brief Gets the Y coordinate of a bullet
+     * @param index Index between 0 and getCount() - 1
+     * @return Y coordinate
+     */
+    int getY(int index) const;
+};
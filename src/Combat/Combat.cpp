@@ -7,13 +7,10 @@
  */
 
 #include "Combat.h"
+#include "../UI/InputSource.h"
 #include <algorithm>
-#include <thread>
 #include <iostream>
 
-// Initialize static member for pause functionality
-Combat* Combat::currentInstance = nullptr;
-
 /**
  * @brief Constructor for the Combat system
  * @param player Reference to the player object
@@ -21,70 +18,51 @@ Combat* Combat::currentInstance = nullptr;
  */
 Combat::Combat(Player& player, const WeekCycle& weekCycle)
     : player(player),
-      weapon(player.getWeaponLevel()), 
-      zombieManager(player.getDifficulty(), weekCycle.getCurrentWeek()),
-      playerX(WIDTH / 2), 
-      playerY(HEIGHT - 1),
-      initialHP(player.getTotalHP()), 
-      HP(player.getTotalHP()),
+      sim(player.getDifficulty(), weekCycle.getCurrentWeek(), player.getWeaponLevel(), player.getTotalHP()),
       isPaused(false),
-      pausedDuration(std::chrono::steady_clock::duration::zero()) {
-    
-    currentInstance = this;
-    setupPauseCallback();
+      frame(PANEL_WIDTH, PANEL_HEIGHT),
+      sizeGeneration(0),
+      shownHP(NOT_SHOWN),
+      shownTimeLeft(NOT_SHOWN),
+      shownWeaponLevel(NOT_SHOWN),
+      shownEnemyHP(NOT_SHOWN) {
     
-    // Set game duration based on current week
-    int gameDurationArr[5] = {40, 40, 50, 50, 60};
-    gameDuration = gameDurationArr[weekCycle.getCurrentWeek() - 1];
-    startTime = std::chrono::steady_clock::now();
-}
-
-/**
- * @brief Sets up the pause callback function for the 'P' key
- */
-void Combat::setupPauseCallback() {
-    Terminal::GetInstance().SetPKeyCallback(togglePauseCallback);
-}
-
-/**
- * @brief Clears the pause callback function
- */
-void Combat::clearPauseCallback() {
-    Terminal::GetInstance().ClearPKeyCallback();
-}
-
-/**
- * @brief Static callback function to toggle pause state
- */
-void Combat::togglePauseCallback() {
-    if (currentInstance) {
-        currentInstance->togglePause();
-    }
+    nextTick = Clock::Get().Now();
 }
 
 /**
  * @brief Toggles the pause state of the game
- * Handles pause screen display and pause duration tracking
+ * Handles pause screen display; game time is counted in ticks, so the
+ * tick clock is restarted on resume instead of catching up the pause.
+ * The pause screen reads its own keys, so the key reader is stopped
+ * while it is shown
  */
 void Combat::togglePause() {
     if (!isPaused) {
         // Enter pause state
         isPaused = true;
-        pauseStartTime = std::chrono::steady_clock::now();
+        keys.Stop();
         if (SpecialFunctions::showPauseScreen()) {
-            // If user presses P to continue, calculate pause duration and resume
-            pausedDuration += std::chrono::steady_clock::now() - pauseStartTime;
+            // If user presses P to continue, resume from now
             isPaused = false;
+            nextTick = Clock::Get().Now();
         }
+        // The pause screen drew over the arena, so repaint it in full
+        frame.Invalidate();
+        keys.Start();
     } else {
         // Resume game
         isPaused = false;
-        pausedDuration += std::chrono::steady_clock::now() - pauseStartTime;
+        nextTick = Clock::Get().Now();
     }
 }
 
 /**
  * @brief Main game loop
+ * Simulates at a fixed tick rate and renders once per batch of ticks,
+ * so a slow terminal drops frames rather than slowing the horde down.
+ * Keys are decoded by a KeyReader, on a thread of its own when reading
+ * the terminal, and drained once per tick.
  * Handles game initialization, main loop, and victory/defeat conditions
  * @return true if player wins, false if player loses
  */
@@ -94,254 +72,268 @@ bool Combat::run() {
     
     // Initial draw
     UI::ShowInterface("ui/empty.txt");
+    placeFrame();
+    drawChrome();
     draw();
+    keys.Start();
+    nextTick = Clock::Get().Now();
     
-    while (HP > 0 && !isTimeUp()) {
+    while (!sim.isOver()) {
         if (isPaused) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            Clock::Get().SleepFor(std::chrono::milliseconds(100));
             continue;
         }
         
-        processInput();
-        update();
-        draw();
+        if (runDueTicks() > 0) {
+            draw();
+        }
         
-        // Control frame rate
-        std::this_thread::sleep_for(std::chrono::milliseconds(16));
+        // Sleep until the next tick is due, taking keys as they come
+        while (!isPaused && !sim.isOver() && keys.WaitForKey(nextTick)) {
+            readKeys();
+        }
     }
     
+    keys.Stop();
     terminal.ShowCursor();
-    clearPauseCallback();
     
     // Handle combat result
-    bool victory = HP > 0;
+    bool victory = sim.isVictory();
     
     if (victory) {
         Animation::PlaySequence("anim/Win1", 80);
         UI::WaitForEnter("Press Enter to return to home...");
         Animation::PlaySequence("anim/Win2", 80);
-        std::this_thread::sleep_for(std::chrono::seconds(1));
+        Animation::Pause(std::chrono::seconds(1));
     } else {
         Animation::PlaySequence("anim/Lose1", 50);
         UI::WaitForEnter("Press Enter to quit...");
         Animation::PlaySequence("anim/Lose2", 100);
-        std::this_thread::sleep_for(std::chrono::seconds(1));
+        Animation::Pause(std::chrono::seconds(1));
     }
     
     return victory;
 }
 
 /**
- * @brief Processes user input for player movement and shooting
- * Handles arrow keys, WASD, and space bar for shooting
- * Supports multiple shot patterns based on weapon level
+ * @brief Maps a decoded key to a combat action
+ * Handles arrow keys, A/D, Z/C and space bar for shooting
+ * @param key Key decoded by the KeyReader
+ * @return Action for the key, or NONE if it has no combat meaning
  */
-void Combat::processInput() {
-    auto& terminal = Terminal::GetInstance();
-    if (terminal.CheckInput()) {
-        int ch = terminal.GetKeyPress();
-        if (ch == 0x1B) { // ESC or arrow keys
-            if (terminal.CheckInput()) {
-                ch = terminal.GetKeyPress();
-                if (ch == '[') {   
-                    ch = terminal.GetKeyPress();
-                    switch (ch) {
-                        case 75: // Left arrow
-                            playerX = std::max(0, playerX - 1);
-                            break;
-                        case 77: // Right arrow
-                            playerX = std::min(WIDTH - 1, playerX + 1);
-                            break;
-                    }
-                }
-            }
-        } else {
-            switch (toupper(ch)) {
-                case 'A': // Move left
-                    playerX = std::max(0, playerX - 1);
-                    break;
-                case 'D': // Move right
-                    playerX = std::min(WIDTH - 1, playerX + 1);
-                    break;
-                case ' ': // Shoot
-                    if (weapon.getMultiple() == 1) {
-                        bullets.emplace_back(playerX, playerY - 1);
-                    } else if (weapon.getMultiple() == 3 && playerX > 1 && playerX < WIDTH - 2) {
-                        bullets.emplace_back(playerX - 1, playerY - 1);
-                        bullets.emplace_back(playerX, playerY - 1);
-                        bullets.emplace_back(playerX + 1, playerY - 1);
-                    } else if (weapon.getMultiple() == 5 && playerX > 2 && playerX < WIDTH - 3) {
-                        bullets.emplace_back(playerX - 2, playerY - 1);
-                        bullets.emplace_back(playerX - 1, playerY - 1);
-                        bullets.emplace_back(playerX, playerY - 1);
-                        bullets.emplace_back(playerX + 1, playerY - 1);
-                        bullets.emplace_back(playerX + 2, playerY - 1);
-                    } else if (weapon.getMultiple() == 5 && (playerX == 2 || playerX == WIDTH - 3)) {
-                        bullets.emplace_back(playerX - 1, playerY - 1);
-                        bullets.emplace_back(playerX, playerY - 1);
-                        bullets.emplace_back(playerX + 1, playerY - 1);
-                    } else {
-                        bullets.emplace_back(playerX, playerY - 1);
-                    }
-                    break;
-                case 'Z': // Quick move left
-                    playerX = std::max(0, playerX - 3);
-                    break;
-                case 'C': // Quick move right
-                    playerX = std::min(WIDTH - 1, playerX + 3);
-                    break;
-            }
+CombatAction Combat::actionForKey(int key) {
+    switch (key) {
+        case InputSource::KEY_LEFT: // Left arrow
+            return CombatAction::MOVE_LEFT;
+        case InputSource::KEY_RIGHT: // Right arrow
+            return CombatAction::MOVE_RIGHT;
+    }
+    
+    switch (toupper(key)) {
+        case 'A': // Move left
+            return CombatAction::MOVE_LEFT;
+        case 'D': // Move right
+            return CombatAction::MOVE_RIGHT;
+        case ' ': // Shoot
+            return CombatAction::SHOOT;
+        case 'Z': // Quick move left
+            return CombatAction::DASH_LEFT;
+        case 'C': // Quick move right
+            return CombatAction::DASH_RIGHT;
+    }
+    return CombatAction::NONE;
+}
+
+/**
+ * @brief Drains every waiting key and queues its action
+ * Repeats of the action already at the back of the queue are merged, so
+ * key repeat arriving faster than the ticks cannot build up lag, and
+ * presses beyond MAX_PENDING_ACTIONS are dropped; P opens the pause screen
+ */
+void Combat::readKeys() {
+    int key;
+    while (!isPaused && !sim.isOver() && keys.Poll(key)) {
+        if (key == 'p' || key == 'P') {
+            togglePause();
+            continue;
+        }
+        CombatAction action = actionForKey(key);
+        if (action == CombatAction::NONE ||
+            (!pendingActions.empty() && pendingActions.back() == action)) {
+            continue;
+        }
+        if (pendingActions.size() < static_cast<size_t>(MAX_PENDING_ACTIONS)) {
+            pendingActions.push_back(action);
         }
     }
 }
 
 /**
- * @brief Updates game state including bullets, zombies, and collisions
- * Handles bullet movement, zombie updates, and collision detection
+ * @brief Takes the player's action for this tick
+ * One queued key press is applied per tick, in the order pressed
+ * @return Oldest queued action, or NONE if no key was pressed
  */
-void Combat::update() {
-    // Move bullets upward
-    for (auto& bullet : bullets) {
-        bullet.second--;
+CombatAction Combat::processInput() {
+    readKeys();
+    if (pendingActions.empty()) {
+        return CombatAction::NONE;
     }
-    bullets.erase(std::remove_if(bullets.begin(), bullets.end(),
-        [](const std::pair<int, int>& bullet) { return bullet.second < 0; }), bullets.end());
-    
-    // Update zombies
-    zombieManager.update();
-    
-    // Process bullet collisions
-    for (auto it = bullets.begin(); it != bullets.end();) {
-        int damage = zombieManager.processCollision(it->first, it->second, weapon.getDamage());
-        if (damage > 0) {
-            it = bullets.erase(it);
-        } else {
-            ++it;
-        }
+    CombatAction action = pendingActions.front();
+    pendingActions.pop_front();
+    return action;
+}
+
+/**
+ * @brief Runs every simulation tick that is due
+ * When the loop has fallen more than MAX_CATCH_UP_TICKS behind (e.g. the
+ * process was stopped) the excess time is dropped rather than replayed
+ * @return Number of ticks run
+ */
+int Combat::runDueTicks() {
+    auto now = Clock::Get().Now();
+    // The tick due at now itself runs too, so keep MAX_CATCH_UP_TICKS - 1 before it
+    if (now - nextTick > TICK_LENGTH * (MAX_CATCH_UP_TICKS - 1)) {
+        nextTick = now - TICK_LENGTH * (MAX_CATCH_UP_TICKS - 1);
     }
     
-    // Process escaped zombies
-    int escapedDamage = zombieManager.getEscapedZombies() * 10;
-    if (escapedDamage > 0) {
-        HP = std::max(0, HP - escapedDamage);
+    int ticks = 0;
+    while (nextTick <= now && !isPaused && !sim.isOver()) {
+        sim.step(processInput());
+        nextTick += TICK_LENGTH;
+        ticks++;
     }
+    return ticks;
 }
 
 /**
- * @brief Renders the current game state to the screen
- * Draws the game board, player, bullets, zombies, and status information
+ * @brief Centers the frame in the terminal at its current size
+ * Remembers the size generation it placed the frame for, so draw() only
+ * redoes the placement after a resize
  */
-void Combat::draw() const {
+void Combat::placeFrame() {
     auto& terminal = Terminal::GetInstance();
+    sizeGeneration = terminal.GetSizeGeneration();
     auto size = terminal.GetTerminalSize();
     
     // Calculate game area position in the frame
     int gameLeft = (size.width - WIDTH) / 2;
     int gameTop = (size.height - (HEIGHT + 8)) / 2 + 3;
-    
-    // Create scene buffer
-    char scene[HEIGHT][WIDTH + 1] = {};
-    
-    // Initialize scene
+    frame.SetOrigin(gameLeft - ARENA_LEFT, gameTop - 1);
+}
+
+/**
+ * @brief Draws the parts of the panel that never change during a fight
+ * Composed once into the back buffer; Present() resends them only after
+ * the frame was invalidated (start, pause screen or resize)
+ */
+void Combat::drawChrome() {
+    // Draw game area border
+    std::string horizontalBorder = "+" + std::string(WIDTH, '-') + "+";
+    frame.PutText(ARENA_LEFT - 1, 0, horizontalBorder);
+    frame.PutText(ARENA_LEFT - 1, HEIGHT + 1, horizontalBorder);
     for (int y = 0; y < HEIGHT; y++) {
-        std::fill_n(scene[y], WIDTH, ' ');
-        scene[y][WIDTH] = '\0';
+        frame.Put(ARENA_LEFT - 1, y + 1, '|');
+        frame.Put(ARENA_LEFT + WIDTH, y + 1, '|');
     }
     
-    // Place player
-    scene[playerY][playerX] = PLAYER_CHAR;
-    
-    // Place bullets
-    for (const auto& bullet : bullets) {
-        if (bullet.second >= 0 && bullet.second < HEIGHT)
-            scene[bullet.second][bullet.first] = BULLET_CHAR;
+    drawCenteredLine("=== YOUR HOME ===", STATUS_TOP);
+    drawCenteredLine("A/D: move left/right | Space: shoot | Z/C: move faster | P: pause", STATUS_TOP + 5);
+}
+
+/**
+ * @brief Re-formats the status lines whose values changed
+ * Each line is compared by the values it shows, so an unchanged line
+ * costs neither string formatting nor back buffer writes
+ */
+void Combat::drawStatus() {
+    // Display HP and survivor count
+    int HP = sim.getHP();
+    if (HP != shownHP) {
+        shownHP = HP;
+        int survivors = (HP + 99) / 100; // Round up to calculate survivor count
+        drawStatusLine("HP: " + std::to_string(HP) + "/" + std::to_string(sim.getInitialHP()) + 
+                       " (Survivors: " + std::to_string(survivors) + ")", STATUS_TOP + 1);
     }
     
-    // Place enemies
-    for (const auto& zombie : zombieManager.getZombies()) {
-        if (zombie.y >= 0 && zombie.y < HEIGHT)
-            scene[zombie.y][zombie.x] = zombie.getDisplayChar();
+    int timeLeft = sim.getRemainingTime();
+    if (timeLeft != shownTimeLeft) {
+        shownTimeLeft = timeLeft;
+        drawStatusLine("Time left: " + std::to_string(timeLeft) + "s", STATUS_TOP + 2);
     }
     
-    // Draw game area border
-    terminal.MoveCursor(gameLeft - 1, gameTop - 1);
-    std::cout << "+";
-    for (int i = 0; i < WIDTH; i++) std::cout << "-";
-    std::cout << "+";
-    
-    // Draw game area
-    for (int y = 0; y < HEIGHT; y++) {
-        terminal.MoveCursor(gameLeft - 1, gameTop + y);
-        std::cout << "|";
-        terminal.MoveCursor(gameLeft, gameTop + y);
-        std::cout << scene[y];
-        terminal.MoveCursor(gameLeft + WIDTH, gameTop + y);
-        std::cout << "|";
+    const Weapon& weapon = sim.getWeapon();
+    if (weapon.getLevel() != shownWeaponLevel) {
+        shownWeaponLevel = weapon.getLevel();
+        drawStatusLine("Weapon: Lv." + std::to_string(weapon.getLevel()) + 
+                       " (Damage: " + std::to_string(weapon.getDamage()) + ")", STATUS_TOP + 3);
     }
     
-    // Draw bottom border
-    terminal.MoveCursor(gameLeft - 1, gameTop + HEIGHT);
-    std::cout << "+";
-    for (int i = 0; i < WIDTH; i++) std::cout << "-";
-    std::cout << "+";
-    
-    // Display status information
-    int statusY = gameTop + HEIGHT + 1;
-    
-    // Clear status area
-    for (int i = 0; i < 6; i++) {
-        terminal.MoveCursor(gameLeft, statusY + i);
-        std::cout << std::string(WIDTH, ' ');
+    int enemyHP = sim.getZombies().getInitHP();
+    if (enemyHP != shownEnemyHP) {
+        shownEnemyHP = enemyHP;
+        drawStatusLine("Enemy HP: " + std::to_string(enemyHP), STATUS_TOP + 4);
+    }
+}
+
+/**
+ * @brief Renders the current game state to the screen
+ * Composes the arena and status lines into the back buffer, then sends
+ * only the cells that changed since the previous frame. After a resize
+ * the background is redrawn and the frame re-centered and painted in full.
+ * The static chrome is left in the back buffer from drawChrome()
+ */
+void Combat::draw() {
+    if (Terminal::GetInstance().GetSizeGeneration() != sizeGeneration) {
+        UI::ShowInterface("ui/empty.txt");
+        frame.Invalidate();
+        placeFrame();
     }
     
-    std::string statusLine = "=== YOUR HOME ===";
-    terminal.MoveCursor(gameLeft + (WIDTH - statusLine.length()) / 2, statusY);
-    std::cout << statusLine;
+    // Only the playfield is redrawn from scratch
+    frame.ClearRect(ARENA_LEFT, 1, WIDTH, HEIGHT);
     
-    // Display HP and survivor count
-    int survivors = (HP + 99) / 100; // Round up to calculate survivor count
-    std::string hpLine = "HP: " + std::to_string(HP) + "/" + std::to_string(initialHP) + 
-                        " (Survivors: " + std::to_string(survivors) + ")";
-    terminal.MoveCursor(gameLeft + (WIDTH - hpLine.length()) / 2, statusY + 1);
-    std::cout << hpLine;
+    // Place player
+    frame.Put(ARENA_LEFT + sim.getPlayerX(), sim.getPlayerY() + 1, PLAYER_CHAR, PLAYER_COLOR);
     
-    std::string timeLine = "Time left: " + std::to_string(getRemainingTime()) + "s";
-    terminal.MoveCursor(gameLeft + (WIDTH - timeLine.length()) / 2, statusY + 2);
-    std::cout << timeLine;
+    // Place bullets
+    const BulletPool& bullets = sim.getBullets();
+    for (int i = 0; i < bullets.getCount(); i++) {
+        int bulletY = bullets.getY(i);
+        if (bulletY >= 0 && bulletY < HEIGHT)
+            frame.Put(ARENA_LEFT + bullets.getX(i), bulletY + 1, BULLET_CHAR, BULLET_COLOR);
+    }
     
-    std::string weaponLine = "Weapon: Lv." + std::to_string(weapon.getLevel()) + 
-                           " (Damage: " + std::to_string(weapon.getDamage()) + ")";
-    terminal.MoveCursor(gameLeft + (WIDTH - weaponLine.length()) / 2, statusY + 3);
-    std::cout << weaponLine;
+    // Place enemies
+    const ZombieManager& zombieManager = sim.getZombies();
+    for (int i = 0; i < zombieManager.getCount(); i++) {
+        Zombie zombie = zombieManager.getZombie(i);
+        if (zombie.y >= 0 && zombie.y < HEIGHT)
+            frame.Put(ARENA_LEFT + zombie.x, zombie.y + 1, zombie.getDisplayChar(),
+                      zombie.isWounded() ? WOUNDED_ZOMBIE_COLOR : ZOMBIE_COLOR);
+    }
     
-    std::string enemyLine = "Enemy HP: " + std::to_string(zombieManager.getInitHP());
-    terminal.MoveCursor(gameLeft + (WIDTH - enemyLine.length()) / 2, statusY + 4);
-    std::cout << enemyLine;
+    drawStatus();
     
-    std::string hintLine = "A/D: move left/right | Space: shoot | Z/C: move faster | P: pause";
-    terminal.MoveCursor(gameLeft + (WIDTH - hintLine.length()) / 2, statusY + 5);
-    std::cout << hintLine;
-
-    // Force output flush
-    std::cout.flush();
+    frame.Present();
 }
 
 /**
- * @brief Checks if the game time has expired
- * @return true if time is up, false otherwise
+ * @brief Writes a line centered over the arena into the frame
+ * Lines wider than the arena overhang it evenly on both sides
+ * @param text The text to write
+ * @param row Panel row to write on
  */
-bool Combat::isTimeUp() const {
-    auto elapsed = std::chrono::steady_clock::now() - startTime - pausedDuration;
-    return std::chrono::duration_cast<std::chrono::seconds>(elapsed).count() >= gameDuration;
+void Combat::drawCenteredLine(const std::string& text, int row) {
+    frame.PutText((PANEL_WIDTH - static_cast<int>(text.length())) / 2, row, text);
 }
 
 /**
- * @brief Calculates remaining game time
- * @return Remaining time in seconds
+ * @brief Replaces a status line with new text
+ * The row is blanked first, as the new text may be shorter than the old
+ * @param text The text to write
+ * @param row Panel row to write on
  */
-int Combat::getRemainingTime() const {
-    auto remaining = gameDuration - 
-        std::chrono::duration_cast<std::chrono::seconds>(
-            std::chrono::steady_clock::now() - startTime - pausedDuration).count();
-    return std::max(0, static_cast<int>(remaining));
-} 
\ No newline at end of file
+void Combat::drawStatusLine(const std::string& text, int row) {
+    frame.ClearRect(0, row, PANEL_WIDTH, 1);
+    drawCenteredLine(text, row);
+}
@@ -2,9 +2,10 @@
  * @file Combat.h
  * @brief Combat system for player-zombie interactions
  * 
- * This file defines the Combat class, which manages the core combat mechanics
- * of the game. It handles player movement, shooting, zombie spawning, and
- * collision detection in a grid-based combat system.
+ * This file defines the Combat class, which plays a combat wave live in the
+ * terminal. The rules themselves (player movement, shooting, zombie spawning
+ * and collision detection) live in CombatSim; Combat feeds it keyboard input
+ * at a fixed tick rate and draws its state.
  * 
  * The Combat class features:
  * - Player movement and shooting mechanics
@@ -16,21 +17,25 @@
  * 
  * @see Player
  * @see Weapon
- * @see Zombie
+ * @see CombatSim
  * @see WeekCycle
  */
 
 #pragma once
-#include "Weapon.h"
-#include "Zombie.h"
+#include "CombatSim.h"
 #include "../UI/Terminal.h"
 #include "../UI/UI.h"
 #include "../UI/Animation.h"
+#include "../UI/FrameBuffer.h"
+#include "../UI/KeyReader.h"
 #include "../Core/Player.h"
 #include "../Core/WeekCycle.h"
 #include "../Utils/SpecialFunctions.h"
+#include "../Utils/Clock.h"
 #include <vector>
+#include <deque>
 #include <chrono>
+#include <climits>
 
 /**
  * @class Combat
@@ -39,75 +44,114 @@
 class Combat {
 private:
     // Game board dimensions and display characters
-    static const int WIDTH = 25;
-    static const int HEIGHT = 25;
+    static const int WIDTH = CombatSim::WIDTH;
+    static const int HEIGHT = CombatSim::HEIGHT;
     static const char PLAYER_CHAR = 'A';
     static const char BULLET_CHAR = '|';
     
-    Player& player;                // Reference to the player object
-    Weapon weapon;                 // Player's weapon
-    ZombieManager zombieManager;   // Manages zombie spawning and movement
-    std::vector<std::pair<int, int>> bullets;  // Active bullets in the game
+    // Arena colors, so the player, bullets and zombies stand apart
+    static constexpr Color PLAYER_COLOR = Color::BRIGHT_CYAN;
+    static constexpr Color BULLET_COLOR = Color::BRIGHT_YELLOW;
+    static constexpr Color ZOMBIE_COLOR = Color::BRIGHT_RED;       // Healthy zombie ('*')
+    static constexpr Color WOUNDED_ZOMBIE_COLOR = Color::MAGENTA;  // Wounded zombie ('+')
+    
+    // Screen region of the fight: the arena with its border plus six
+    // status lines, wide enough to hold the key-hint line
+    static const int PANEL_WIDTH = 67;
+    static const int PANEL_HEIGHT = HEIGHT + 8;
+    static const int ARENA_LEFT = (PANEL_WIDTH - WIDTH) / 2;  // Panel column of arena x = 0
+    static const int STATUS_TOP = HEIGHT + 2;                 // Panel row of the first status line
+    static constexpr int NOT_SHOWN = INT_MIN;                 // Status value not drawn yet
     
-    int playerX;                   // Player's X coordinate
-    int playerY;                   // Player's Y coordinate
-    int initialHP;                 // Initial health points
-    int HP;                        // Current health points
-    int gameDuration;              // Total game duration in seconds
-    std::chrono::steady_clock::time_point startTime;  // Game start time
+    // Simulation runs at a fixed tick rate independent of rendering speed
+    static constexpr int MAX_CATCH_UP_TICKS = 15;  // Ticks simulated at most before a render
+    static constexpr std::chrono::nanoseconds TICK_LENGTH{1000000000 / CombatSim::TICKS_PER_SECOND};
+    static const int MAX_PENDING_ACTIONS = 8;      // Key presses buffered ahead of the ticks
+    
+    Player& player;                // Reference to the player object
+    CombatSim sim;                 // Rules and state of the wave
+    Clock::TimePoint nextTick;     // Deadline of the next simulation tick
+    std::deque<CombatAction> pendingActions; // Actions read but not yet simulated
+    KeyReader keys;                // Decodes key presses, off the game thread when possible
     
     // Pause system variables
     bool isPaused;                 // Current pause state
-    static Combat* currentInstance; // Current combat instance for pause handling
-    std::chrono::steady_clock::time_point pauseStartTime;  // When the game was paused
-    std::chrono::steady_clock::duration pausedDuration;    // Total time spent paused
+    
+    FrameBuffer frame;             // Front/back buffers for diff-based redraws
+    unsigned sizeGeneration;       // Terminal size generation the frame is placed for
+    
+    // Status values the frame shows, so a line is only re-formatted
+    // when its value changes
+    int shownHP;
+    int shownTimeLeft;
+    int shownWeaponLevel;
+    int shownEnemyHP;
+    
+    /**
+     * @brief Toggles the pause state of the game
+     */
+    void togglePause();
     
     /**
-     * @brief Sets up the pause callback function
+     * @brief Maps a decoded key to a combat action
+     * @param key Key decoded by the KeyReader
+     * @return Action for the key, or NONE if it has no combat meaning
      */
-    void setupPauseCallback();
+    static CombatAction actionForKey(int key);
     
     /**
-     * @brief Clears the pause callback function
+     * @brief Drains every waiting key and queues its action
      */
-    void clearPauseCallback();
+    void readKeys();
     
     /**
-     * @brief Static callback function to toggle pause state
+     * @brief Takes the player's action for this tick
+     * @return Oldest queued action, or NONE if no key was pressed
      */
-    static void togglePauseCallback();
+    CombatAction processInput();
     
     /**
-     * @brief Toggles the pause state of the game
+     * @brief Runs every simulation tick that is due
+     * @return Number of ticks run
      */
-    void togglePause();
+    int runDueTicks();
+    
+    /**
+     * @brief Centers the frame in the terminal at its current size
+     */
+    void placeFrame();
     
     /**
-     * @brief Processes user input for player movement and shooting
+     * @brief Draws the parts of the panel that never change during a fight
+     * Border, header and key hints stay in the frame's back buffer, so
+     * they are composed once and only sent again when the frame is repainted
      */
-    void processInput();
+    void drawChrome();
     
     /**
-     * @brief Updates game state including bullets, zombies, and collisions
+     * @brief Re-formats the status lines whose values changed
      */
-    void update();
+    void drawStatus();
     
     /**
      * @brief Renders the current game state to the screen
+     * Only cells that changed since the previous frame are sent
      */
-    void draw() const;
+    void draw();
     
     /**
-     * @brief Checks if the game time has expired
-     * @return true if time is up, false otherwise
+     * @brief Writes a line centered over the arena into the frame
+     * @param text The text to write
+     * @param row Panel row to write on
      */
-    bool isTimeUp() const;
+    void drawCenteredLine(const std::string& text, int row);
     
     /**
-     * @brief Calculates remaining game time
-     * @return Remaining time in seconds
+     * @brief Replaces a status line with new text
+     * @param text The text to write
+     * @param row Panel row to write on
      */
-    int getRemainingTime() const;
+    void drawStatusLine(const std::string& text, int row);
     
 public:
     /**
@@ -0,0 +1,211 @@
+/**
+ * @file CombatSim.cpp
+ * @brief Implementation of the headless combat rules
+ * @details Applies one player action and one update per tick, with no
+ *          terminal I/O or wall-clock time.
+ */
+
+#include "CombatSim.h"
+#include <algorithm>
+
+/**
+ * @brief Constructor for CombatSim
+ * @param difficulty Game difficulty (1-3)
+ * @param week Current week (1-5)
+ * @param weaponLevel Player's weapon level
+ * @param totalHP Player's total health points
+ */
+CombatSim::CombatSim(int difficulty, int week, int weaponLevel, int totalHP)
+    : weapon(weaponLevel),
+      zombieManager(difficulty, week),
+      // At most one volley per tick, and a bullet leaves the arena within HEIGHT ticks
+      bullets(weapon.getMultiple() * HEIGHT),
+      playerX(WIDTH / 2),
+      playerY(HEIGHT - 1),
+      initialHP(totalHP),
+      HP(totalHP),
+      elapsedTicks(0) {
+    
+    // Set game duration based on current week
+    int gameDurationArr[5] = {40, 40, 50, 50, 60};
+    gameDuration = gameDurationArr[week - 1];
+}
+
+/**
+ * @brief Advances the wave by one tick
+ * @param action Player action for this tick
+ */
+void CombatSim::step(CombatAction action) {
+    switch (action) {
+        case CombatAction::MOVE_LEFT:
+            playerX = std::max(0, playerX - 1);
+            break;
+        case CombatAction::MOVE_RIGHT:
+            playerX = std::min(WIDTH - 1, playerX + 1);
+            break;
+        case CombatAction::DASH_LEFT:
+            playerX = std::max(0, playerX - 3);
+            break;
+        case CombatAction::DASH_RIGHT:
+            playerX = std::min(WIDTH - 1, playerX + 3);
+            break;
+        case CombatAction::SHOOT:
+            shoot();
+            break;
+        case CombatAction::NONE:
+            break;
+    }
+    
+    update();
+    elapsedTicks++;
+}
+
+/**
+ * @brief Steps the wave until it ends
+ * @param policy Called once per tick to choose the player action
+ * @return true if the player survives, false otherwise
+ */
+bool CombatSim::runToEnd(const InputPolicy& policy) {
+    while (!isOver()) {
+        step(policy(*this));
+    }
+    return isVictory();
+}
+
+/**
+ * @brief Fires a volley from the player's position
+ * Volleys wider than the space beside the arena wall are narrowed
+ */
+void CombatSim::shoot() {
+    if (weapon.getMultiple() == 1) {
+        bullets.fire(playerX, playerY - 1);
+    } else if (weapon.getMultiple() == 3 && playerX > 1 && playerX < WIDTH - 2) {
+        bullets.fire(playerX - 1, playerY - 1);
+        bullets.fire(playerX, playerY - 1);
+        bullets.fire(playerX + 1, playerY - 1);
+    } else if (weapon.getMultiple() == 5 && playerX > 2 && playerX < WIDTH - 3) {
+        bullets.fire(playerX - 2, playerY - 1);
+        bullets.fire(playerX - 1, playerY - 1);
+        bullets.fire(playerX, playerY - 1);
+        bullets.fire(playerX + 1, playerY - 1);
+        bullets.fire(playerX + 2, playerY - 1);
+    } else if (weapon.getMultiple() == 5 && (playerX == 2 || playerX == WIDTH - 3)) {
+        bullets.fire(playerX - 1, playerY - 1);
+        bullets.fire(playerX, playerY - 1);
+        bullets.fire(playerX + 1, playerY - 1);
+    } else {
+        bullets.fire(playerX, playerY - 1);
+    }
+}
+
+/**
+ * @brief Updates bullets, zombies, collisions and escape damage
+ */
+void CombatSim::update() {
+    // Zombies move independently of bullets, so update them first and
+    // let the bullets advance and collide against the new positions
+    zombieManager.update();
+    bullets.advance(zombieManager, weapon.getDamage());
+    
+    // Drop dead zombies and charge for the escaped ones
+    int escapedDamage = zombieManager.removeEscapedAndKilled() * 10;
+    if (escapedDamage > 0) {
+        HP = std::max(0, HP - escapedDamage);
+    }
+}
+
+/**
+ * @brief Checks if the wave has ended
+ * @return true if the player died or time is up
+ */
+bool CombatSim::isOver() const {
+    return HP <= 0 || isTimeUp();
+}
+
+/**
+ * @brief Checks if the player survived
+ * @return true if the player still has health points
+ */
+bool CombatSim::isVictory() const {
+    return HP > 0;
+}
+
+/**
+ * @brief Checks if the wave time has expired
+ * @return true if time is up, false otherwise
+ */
+bool CombatSim::isTimeUp() const {
+    return elapsedTicks >= gameDuration * TICKS_PER_SECOND;
+}
+
+/**
+ * @brief Calculates remaining wave time
+ * @return Remaining time in seconds
+ */
+int CombatSim::getRemainingTime() const {
+    return std::max(0, gameDuration - elapsedTicks / TICKS_PER_SECOND);
+}
+
+/**
+ * @brief Gets the number of ticks run so far
+ * @return Elapsed ticks
+ */
+int CombatSim::getElapsedTicks() const {
+    return elapsedTicks;
+}
+
+/**
+ * @brief Gets the player's current health points
+ * @return Current health points
+ */
+int CombatSim::getHP() const {
+    return HP;
+}
+
+/**
+ * @brief Gets the player's health points at the start of the wave
+ * @return Initial health points
+ */
+int CombatSim::getInitialHP() const {
+    return initialHP;
+}
+
+/**
+ * @brief Gets the player's X coordinate
+ * @return X coordinate
+ */
+int CombatSim::getPlayerX() const {
+    return playerX;
+}
+
+/**
+ * @brief Gets the player's Y coordinate
+ * @return Y coordinate
+ */
+int CombatSim::getPlayerY() const {
+    return playerY;
+}
+
+/**
+ * @brief Gets the player's weapon
+ * @return Reference to the weapon
+ */
+const Weapon& CombatSim::getWeapon() const {
+    return weapon;
+}
+
+/**
+ * @brief Gets the zombies of the wave
+ * @return Reference to the zombie manager
+ */
+const ZombieManager& CombatSim::getZombies() const {
+    return zombieManager;
+}
+
+/**
+ * @brief Gets the bullets in flight
+ * @return Reference to the bullet pool
+ */
+const BulletPool& CombatSim::getBullets() const {
+    return bullets;
+}
@@ -0,0 +1,173 @@
+/**
+ * @file CombatSim.h
+ * @brief Headless combat rules stepped one tick at a time
+ * 
+ * This file defines the CombatSim class, which holds the state and rules
+ * of a single combat wave with no terminal, UI or clock dependency:
+ * - Player movement and shot patterns
+ * - Zombie spawning, movement and escape damage
+ * - Bullet advance and collisions
+ * - Victory and defeat conditions, counted in ticks
+ * 
+ * Combat drives it in real time from the keyboard; anything else can step
+ * it as fast as it likes with an input policy, e.g. to evaluate waves in
+ * bulk for balancing.
+ * 
+ * @see Combat
+ * @see ZombieManager
+ * @see BulletPool
+ */
+
+#pragma once
+#include "Weapon.h"
+#include "Zombie.h"
+#include "BulletPool.h"
+#include <functional>
+
+/**
+ * @brief Player action applied during one tick
+ */
+enum class CombatAction {
+    NONE,        ///< Do nothing
+    MOVE_LEFT,   ///< Move one column left
+    MOVE_RIGHT,  ///< Move one column right
+    DASH_LEFT,   ///< Move three columns left
+    DASH_RIGHT,  ///< Move three columns right
+    SHOOT        ///< Fire a volley
+};
+
+/**
+ * @class CombatSim
+ * @brief State and rules of one combat wave, advanced by tick count
+ */
+class CombatSim {
+public:
+    // Arena dimensions
+    static const int WIDTH = 25;
+    static const int HEIGHT = 25;
+    
+    // Simulation ticks per second of game time
+    static constexpr int TICKS_PER_SECOND = 60;
+    
+    /**
+     * @brief Chooses the player action for the next tick
+     */
+    using InputPolicy = std::function<CombatAction(const CombatSim&)>;
+    
+    /**
+     * @brief Constructor for CombatSim
+     * @param difficulty Game difficulty (1-3)
+     * @param week Current week (1-5), which sets wave length and zombie health
+     * @param weaponLevel Player's weapon level
+     * @param totalHP Player's total health points
+     */
+    CombatSim(int difficulty, int week, int weaponLevel, int totalHP);
+    
+    /**
+     * @brief Advances the wave by one tick
+     * @param action Player action for this tick
+     */
+    void step(CombatAction action);
+    
+    /**
+     * @brief Steps the wave until it ends
+     * @param policy Called once per tick to choose the player action
+     * @return true if the player survives, false otherwise
+     */
+    bool runToEnd(const InputPolicy& policy);
+    
+    /**
+     * @brief Checks if the wave has ended
+     * @return true if the player died or time is up
+     */
+    bool isOver() const;
+    
+    /**
+     * @brief Checks if the player survived
+     * @return true if the player still has health points
+     */
+    bool isVictory() const;
+    
+    /**
+     * @brief Checks if the wave time has expired
+     * @return true if time is up, false otherwise
+     */
+    bool isTimeUp() const;
+    
+    /**
+     * @brief Calculates remaining wave time
+     * @return Remaining time in seconds
+     */
+    int getRemainingTime() const;
+    
+    /**
+     * @brief Gets the number of ticks run so far
+     * @return Elapsed ticks
+     */
+    int getElapsedTicks() const;
+    
+    /**
+     * @brief Gets the player's current health points
+     * @return Current health points
+     */
+    int getHP() const;
+    
+    /**
+     * @brief Gets the player's health points at the start of the wave
+     * @return Initial health points
+     */
+    int getInitialHP() const;
+    
+    /**
+     * @brief Gets the player's X coordinate
+     * @return X coordinate
+     */
+    int getPlayerX() const;
+    
+    /**
+     * @brief Gets the player's Y coordinate
+     * @return Y coordinate
+     */
+    int getPlayerY() const;
+    
+    /**
+     * @brief Gets the player's weapon
+     * @return Reference to the weapon
+     */
+    const Weapon& getWeapon() const;
+    
+    /**
+     * @brief Gets the zombies of the wave
+     * @return Reference to the zombie manager
+     */
+    const ZombieManager& getZombies() const;
+    
+    /**
+     * @brief Gets the bullets in flight
+     * @return Reference to the bullet pool
+     */
+    const BulletPool& getBullets() const;
+    
+private:
+    Weapon weapon;                 // Player's weapon
+    ZombieManager zombieManager;   // Manages zombie spawning and movement
+    BulletPool bullets;            // Active bullets in the game
+    
+    int playerX;                   // Player's X coordinate
+    int playerY;                   // Player's Y coordinate
+    int initialHP;                 // Initial health points
+    int HP;                        // Current health points
+    int gameDuration;              // Total wave duration in seconds
+    int elapsedTicks;              // Ticks run so far
+    
+    /**
+     * @brief Fires a volley from the player's position
+     * Supports multiple shot patterns based on weapon level
+     */
+    void shoot();
+    
+    /**
+     * @brief Updates bullets, zombies, collisions and escape damage
+     */
+    void update();
+};
@@ -7,6 +7,7 @@
 
 #include "Zombie.h"
 #include "../Utils/Random.h"
+#include <algorithm>
 
 /**
  * @brief Constructor for a Zombie
@@ -21,7 +22,15 @@ Zombie::Zombie(int x, int y, int health) : x(x), y(y), health(health) {}
  * @return '*' for healthy zombies (health >= 45), '+' for damaged zombies
  */
 char Zombie::getDisplayChar() const {
-    return health >= 45 ? '*' : '+';
+    return isWounded() ? '+' : '*';
+}
+
+/**
+ * @brief Checks whether the zombie has lost enough health to show it
+ * @return true if health is below 45
+ */
+bool Zombie::isWounded() const {
+    return health < 45;
 }
 
 /**
@@ -33,6 +42,8 @@ ZombieManager::ZombieManager(int difficulty, int gameLevel)
     : enemySpeed(20), enemyMoveCounter(0), enemySpawnCounter(0), 
       enemySpawnInterval(30), spawnProbability(15) {
     
+    cellHead.assign(ARENA_WIDTH * ARENA_HEIGHT, -1);
+    
     // Set initial HP based on difficulty and level
     if (difficulty == 1) {
         int enemyHParr[5] = {36, 45, 54, 63, 72};
@@ -69,9 +80,13 @@ void ZombieManager::update() {
  * Randomly spawns zombies based on probability
  */
 void ZombieManager::spawnZombie() {
-    if (Random::Chance(spawnProbability / 100.0f)) {
-        int x = Random::Range(0, 24); // WIDTH - 1
-        zombies.emplace_back(x, 0, enemyInitHP);
+    if (Random::Chance(spawnProbability / 100.0f, Random::Stream::SPAWN)) {
+        int x = Random::Range(0, ARENA_WIDTH - 1, Random::Stream::SPAWN);
+        zombieX.push_back(x);
+        zombieY.push_back(0);
+        zombieHealth.push_back(enemyInitHP);
+        nextInCell.push_back(-1);
+        linkToGrid(getCount() - 1);
     }
 }
 
@@ -80,60 +95,53 @@ void ZombieManager::spawnZombie() {
  * Moves zombies downward (increasing Y coordinate)
  */
 void ZombieManager::moveZombies() {
-    for (auto& zombie : zombies) {
-        zombie.y++;
+    for (int& y : zombieY) {
+        y++;
     }
+    rebuildGrid();
 }
 
 /**
  * @brief Processes collision between a position and zombies
+ * Only the live zombies chained to the cell are hit
  * @param x X coordinate to check
  * @param y Y coordinate to check
  * @param damage Damage to apply on collision
  * @return Total damage dealt to zombies
  */
 int ZombieManager::processCollision(int x, int y, int damage) {
+    if (x < 0 || x >= ARENA_WIDTH || y < 0 || y >= ARENA_HEIGHT) {
+        return 0;
+    }
+    
     int totalDamage = 0;
-    for (auto it = zombies.begin(); it != zombies.end();) {
-        if (it->x == x && it->y == y) {
-            it->health -= damage;
-            if (it->health <= 0) {
-                totalDamage += damage;
-                it = zombies.erase(it);
-            } else {
-                ++it;
-            }
-        } else {
-            ++it;
+    for (int i = cellHead[y * ARENA_WIDTH + x]; i != -1; i = nextInCell[i]) {
+        if (zombieHealth[i] <= 0) {
+            continue;
+        }
+        zombieHealth[i] -= damage;
+        if (zombieHealth[i] <= 0) {
+            totalDamage += damage;
         }
     }
     return totalDamage;
 }
 
 /**
- * @brief Gets the number of zombies that have escaped
- * Removes escaped zombies and returns their count
- * @return Number of escaped zombies
+ * @brief Gets the number of active zombies
+ * @return Number of zombies
  */
-int ZombieManager::getEscapedZombies() {
-    int escaped = 0;
-    for (auto it = zombies.begin(); it != zombies.end();) {
-        if (it->y >= 25) { // HEIGHT
-            escaped++;
-            it = zombies.erase(it);
-        } else {
-            ++it;
-        }
-    }
-    return escaped;
+int ZombieManager::getCount() const {
+    return static_cast<int>(zombieX.size());
 }
 
 /**
- * @brief Gets the collection of active zombies
- * @return Reference to the vector of zombies
+ * @brief Gets one active zombie
+ * @param index Index between 0 and getCount() - 1
+ * @return Position and health of the zombie
  */
-const std::vector<Zombie>& ZombieManager::getZombies() const {
-    return zombies;
+Zombie ZombieManager::getZombie(int index) const {
+    return Zombie(zombieX[index], zombieY[index], zombieHealth[index]);
 }
 
 /**
@@ -142,4 +150,68 @@ const std::vector<Zombie>& ZombieManager::getZombies() const {
  */
 int ZombieManager::getInitHP() const {
     return enemyInitHP;
-} 
\ No newline at end of file
+}
+
+/**
+ * @brief Adds a zombie to the chain of the cell it stands in
+ * Zombies outside the arena (escaped) are left out of the grid
+ * @param index Index of the zombie
+ */
+void ZombieManager::linkToGrid(int index) {
+    int x = zombieX[index];
+    int y = zombieY[index];
+    if (x < 0 || x >= ARENA_WIDTH || y < 0 || y >= ARENA_HEIGHT) {
+        nextInCell[index] = -1;
+        return;
+    }
+    int& head = cellHead[y * ARENA_WIDTH + x];
+    nextInCell[index] = head;
+    head = index;
+}
+
+/**
+ * @brief Rebuilds the occupancy grid from the zombie positions
+ * Called whenever zombies move or indices change
+ */
+void ZombieManager::rebuildGrid() {
+    std::fill(cellHead.begin(), cellHead.end(), -1);
+    nextInCell.resize(zombieX.size());
+    for (int i = getCount() - 1; i >= 0; i--) {
+        linkToGrid(i);
+    }
+}
+
+/**
+ * @brief Removes the zombies that escaped or were killed
+ * Each removed zombie is overwritten by the last one (swap and pop),
+ * so the whole pass is O(zombies) however many are removed
+ * @return Number of escaped zombies removed
+ */
+int ZombieManager::removeEscapedAndKilled() {
+    int escaped = 0;
+    size_t count = zombieX.size();
+    size_t i = 0;
+    while (i < count) {
+        bool killed = zombieHealth[i] <= 0;
+        bool escapedNow = !killed && zombieY[i] >= ARENA_HEIGHT;
+        if (killed || escapedNow) {
+            if (escapedNow) {
+                escaped++;
+            }
+            count--;
+            zombieX[i] = zombieX[count];
+            zombieY[i] = zombieY[count];
+            zombieHealth[i] = zombieHealth[count];
+        } else {
+            i++;
+        }
+    }
+    
+    if (count != zombieX.size()) {
+        zombieX.resize(count);
+        zombieY.resize(count);
+        zombieHealth.resize(count);
+        rebuildGrid();
+    }
+    return escaped;
+}
\ No newline at end of file
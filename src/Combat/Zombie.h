@@ -4,7 +4,8 @@
  * 
  * This file defines the Zombie struct and ZombieManager class, which handle
  * zombie entities and their behavior in the game. It manages zombie spawning,
- * movement, health, and interactions with the player.
+ * movement, health, and interactions with the player. Zombies are stored as
+ * separate position and health arrays; Zombie is a snapshot of one of them.
  * 
  * The Zombie system features:
  * - Individual zombie tracking
@@ -12,6 +13,8 @@
  * - Movement mechanics
  * - Health management
  * - Difficulty scaling
+ * - Occupancy grid for constant-time collision lookup
+ * - Unordered removal in a single compaction pass per tick
  * 
  * @see Combat
  * @see Player
@@ -22,7 +25,7 @@
 
 /**
  * @struct Zombie
- * @brief Represents a single zombie entity with position and health
+ * @brief Position and health of a single zombie, as read from ZombieManager
  */
 struct Zombie {
     int x;          // X coordinate position
@@ -42,6 +45,12 @@ struct Zombie {
      * @return Character representing the zombie
      */
     char getDisplayChar() const;
+    
+    /**
+     * @brief Checks whether the zombie has lost enough health to show it
+     * @return true if the zombie is drawn as damaged
+     */
+    bool isWounded() const;
 };
 
 /**
@@ -50,7 +59,17 @@ struct Zombie {
  */
 class ZombieManager {
 private:
-    std::vector<Zombie> zombies;   // Collection of active zombies
+    // Arena dimensions, matching Combat
+    static const int ARENA_WIDTH = 25;
+    static const int ARENA_HEIGHT = 25;
+    
+    // Zombie attributes, one entry per zombie at the same index
+    std::vector<int> zombieX;      // X coordinates
+    std::vector<int> zombieY;      // Y coordinates
+    std::vector<int> zombieHealth; // Health points; zero or less once killed
+    
+    std::vector<int> cellHead;     // Index of the first zombie in each arena cell, or -1
+    std::vector<int> nextInCell;   // Index of the next zombie in the same cell, or -1
     int enemyInitHP;               // Initial health points for new zombies
     int enemySpeed;                // Movement speed of zombies
     int enemyMoveCounter;          // Counter for zombie movement timing
@@ -58,6 +77,17 @@ private:
     int enemySpawnInterval;        // Time between zombie spawns
     int spawnProbability;          // Probability of spawning a new zombie
     
+    /**
+     * @brief Adds a zombie to the chain of the cell it stands in
+     * @param index Index of the zombie in zombies
+     */
+    void linkToGrid(int index);
+    
+    /**
+     * @brief Rebuilds the occupancy grid from the zombie positions
+     */
+    void rebuildGrid();
+    
 public:
     /**
      * @brief Constructor for ZombieManager
@@ -83,6 +113,10 @@ public:
     
     /**
      * @brief Processes collision between a position and zombies
+     * 
+     * Looks the cell up in the occupancy grid, so a miss costs O(1)
+     * regardless of how many zombies are alive. Killed zombies stay in
+     * place, ignored, until removeEscapedAndKilled() compacts the arrays.
      * @param x X coordinate to check
      * @param y Y coordinate to check
      * @param damage Damage to apply on collision
@@ -91,16 +125,26 @@ public:
     int processCollision(int x, int y, int damage);
     
     /**
-     * @brief Gets the number of zombies that have escaped
-     * @return Number of escaped zombies
+     * @brief Removes the zombies that escaped or were killed
+     * 
+     * Called once per tick after all collisions are processed, in a
+     * single compaction pass.
+     * @return Number of escaped zombies removed
+     */
+    int removeEscapedAndKilled();
+    
+    /**
+     * @brief Gets the number of active zombies
+     * @return Number of zombies
      */
-    int getEscapedZombies();
+    int getCount() const;
     
     /**
-     * @brief Gets the collection of active zombies
-     * @return Reference to the vector of zombies
+     * @brief Gets one active zombie
+     * @param index Index between 0 and getCount() - 1
+     * @return Position and health of the zombie
      */
-    const std::vector<Zombie>& getZombies() const;
+    Zombie getZombie(int index) const;
     
     /**
      * @brief Gets the initial health points for new zombies
@@ -0,0 +1,140 @@
+/**
+ * @file CampaignSim.cpp
+ * @brief Implementation of the headless campaign
+ * @details Mirrors the day and combat flow of Game and the resource rules
+ *          of the counters, with a strategy in place of keyboard input.
+ */
+#include "CampaignSim.h"
+#include "Difficulty.h"
+#include "../Counters/Explore.h"
+#include "../Counters/Recruit.h"
+#include "../Utils/Constants.h"
+#include <algorithm>
+
+/**
+ * @brief Constructor for CampaignSim
+ * Starts the player with the same resources as Game::initNewGame
+ * @param difficulty Difficulty preset name
+ * @param strategy Strategy making every decision
+ */
+CampaignSim::CampaignSim(const std::string& difficulty, CampaignStrategy& strategy)
+    : m_player(Difficulty::GetConfig(difficulty).initialPeople,
+               Difficulty::GetConfig(difficulty).initialPeople * 10, // Initial food
+               Difficulty::GetConfig(difficulty).initialPeople * 10, // Initial gold
+               difficulty),
+      m_strategy(strategy) {}
+
+/**
+ * @brief Plays the campaign to the end
+ * Follows Game::processDay and Game::triggerCombat
+ * @return CampaignResult How and when the campaign ended
+ */
+CampaignResult CampaignSim::run() {
+    while (true) {
+        playDay();
+        m_weekCycle.advanceDay();
+        
+        if (m_weekCycle.getCurrentDay() > GameConfig::TOTAL_DAYS) {
+            return finish(CampaignOutcome::VICTORY);
+        } else if (m_player.getPeople() <= 0) {
+            return finish(CampaignOutcome::NO_PEOPLE);
+        }
+        
+        if (m_weekCycle.isThursday()) {
+            if (!fight()) {
+                return finish(CampaignOutcome::COMBAT_LOST);
+            }
+            if (m_weekCycle.getCurrentDay() >= GameConfig::TOTAL_DAYS) {
+                return finish(CampaignOutcome::VICTORY);
+            }
+            m_weekCycle.advanceDay();
+        }
+    }
+}
+
+/**
+ * @brief Plays the worker allocation of one day
+ */
+void CampaignSim::playDay() {
+    m_player.resetDailyWorkers();
+    m_player.consumeDailyFood();
+    
+    while (m_player.getAvailablePeople() > 0) {
+        if (applyAction(m_strategy.chooseAction(m_player, m_weekCycle)) == 0) {
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Applies one counter visit with the same rules as the counters
+ * Visits the interactive counters would refuse assign nobody
+ * @param action Visit to apply
+ * @return int Number of workers the visit assigned
+ */
+int CampaignSim::applyAction(const CampaignAction& action) {
+    const auto& config = Difficulty::GetConfig(m_player.getStringDifficulty());
+    int available = m_player.getAvailablePeople();
+    
+    switch (action.counter) {
+        case CounterType::MINING:
+            if (action.workers <= 0 || action.workers > available) return 0;
+            m_player.addGold(config.goldYield * action.workers);
+            m_player.assignWorkers(0, action.workers, 0, 0, 0);
+            return action.workers;
+            
+        case CounterType::FARMING:
+            if (action.workers <= 0 || action.workers > available) return 0;
+            m_player.addCrop(config.cropYield * action.workers);
+            m_player.assignWorkers(action.workers, 0, 0, 0, 0);
+            return action.workers;
+            
+        case CounterType::SHOP: {
+            int level = m_player.getWeaponLevel();
+            if (level >= 10 || m_player.getGold() < Player::WEAPON_UPGRADE_COST.at(level)) return 0;
+            m_player.upgradeWeapon();
+            m_player.assignWorkers(0, 0, 0, 1, 0);
+            return 1;
+        }
+        
+        case CounterType::RECRUIT: {
+            int recruits = action.workers;
+            if (recruits <= 0 || recruits > RecruitCounter::calculateMaxRecruits(m_player)) return 0;
+            m_player.addCrop(-(RecruitCounter::BASE_COST + RecruitCounter::COST_PER_MEMBER * recruits));
+            m_player.addPeople(recruits);
+            m_player.assignWorkers(0, 0, 1, 0, 0);
+            return 1;
+        }
+        
+        case CounterType::EXPLORE: {
+            if (action.workers <= 0 || action.workers > available) return 0;
+            m_player.assignWorkers(0, 0, 0, 0, action.workers);
+            int value = 0;
+            ExploreCounter::applyResult(m_player, ExploreCounter::executeExplore(m_player), action.workers, value);
+            return action.workers;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Plays the Thursday wave
+ * @return true if the player survives
+ */
+bool CampaignSim::fight() {
+    CombatSim sim(m_player.getDifficulty(), m_weekCycle.getCurrentWeek(),
+                  m_player.getWeaponLevel(), m_player.getTotalHP());
+    return sim.runToEnd([this](const CombatSim& state) {
+        return m_strategy.chooseCombatAction(state);
+    });
+}
+
+/**
+ * @brief Builds the result for the current state
+ * @param outcome How the campaign ended
+ * @return CampaignResult Final state
+ */
+CampaignResult CampaignSim::finish(CampaignOutcome outcome) const {
+    return CampaignResult{outcome, std::min(m_weekCycle.getCurrentDay(), GameConfig::TOTAL_DAYS),
+                          m_player.getPeople(), m_player.getWeaponLevel()};
+}
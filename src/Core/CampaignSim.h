@@ -0,0 +1,137 @@
+/**
+ * @file CampaignSim.h
+ * @brief Headless 25-day campaign driven by a pluggable strategy
+ * 
+ * This file defines the CampaignSim class, which plays one full game
+ * without any terminal I/O, following the same rules as Game:
+ * - Daily food consumption and worker allocation over the five counters,
+ *   using the Difficulty presets, weapon upgrade costs, recruit costs and
+ *   exploration odds of the interactive game
+ * - A CombatSim wave on every Thursday
+ * - Victory after surviving the last Thursday, defeat when no people are
+ *   left or a wave is lost
+ * 
+ * Decisions are delegated to a CampaignStrategy, so balancing tools can
+ * compare play styles over many seeded games.
+ * 
+ * @see Game
+ * @see CombatSim
+ * @see Difficulty
+ */
+
+#pragma once
+#include "Player.h"
+#include "WeekCycle.h"
+#include "../Combat/CombatSim.h"
+#include "../Counters/CounterFactory.h"
+#include <string>
+
+/**
+ * @brief One counter visit: where to go and how many workers to send
+ * 
+ * Shop and recruit always occupy one worker; for recruit, workers is
+ * the number of people to recruit.
+ */
+struct CampaignAction {
+    CounterType counter;  ///< Counter to visit
+    int workers;          ///< Workers to assign, or people to recruit
+};
+
+/**
+ * @brief Decision maker for a headless campaign
+ */
+class CampaignStrategy {
+public:
+    virtual ~CampaignStrategy() = default;
+    
+    /**
+     * @brief Chooses the next counter visit of the day
+     * 
+     * Called until every available person is assigned. A visit that
+     * assigns nobody ends the day with the rest idle.
+     * @param player Current player state
+     * @param weekCycle Current day
+     * @return CampaignAction Visit to make
+     */
+    virtual CampaignAction chooseAction(const Player& player, const WeekCycle& weekCycle) = 0;
+    
+    /**
+     * @brief Chooses the player action for one combat tick
+     * @param sim Current state of the wave
+     * @return CombatAction Action for this tick
+     */
+    virtual CombatAction chooseCombatAction(const CombatSim& sim) = 0;
+};
+
+/**
+ * @brief How a campaign ended
+ */
+enum class CampaignOutcome {
+    VICTORY,        ///< Survived the last Thursday
+    NO_PEOPLE,      ///< Starved or lost everyone exploring
+    COMBAT_LOST     ///< A Thursday wave broke through
+};
+
+/**
+ * @brief Final state of a headless campaign
+ */
+struct CampaignResult {
+    CampaignOutcome outcome;  ///< How the campaign ended
+    int day;                  ///< Day the campaign ended on (1-25)
+    int people;               ///< Population at the end
+    int weaponLevel;          ///< Weapon level at the end
+};
+
+/**
+ * @class CampaignSim
+ * @brief Plays one full game with no terminal I/O
+ */
+class CampaignSim {
+public:
+    /**
+     * @brief Constructor for CampaignSim
+     * @param difficulty Difficulty preset name ("EASY", "MEDIUM", "HARD")
+     * @param strategy Strategy making every decision
+     * @throws std::out_of_range if the difficulty is not a preset
+     */
+    CampaignSim(const std::string& difficulty, CampaignStrategy& strategy);
+    
+    /**
+     * @brief Plays the campaign to the end
+     * 
+     * Random draws come from the calling thread's streams, so seed them
+     * with Random::Seed first for a reproducible result.
+     * @return CampaignResult How and when the campaign ended
+     */
+    CampaignResult run();
+    
+private:
+    Player m_player;              ///< Player resources and weapon
+    WeekCycle m_weekCycle;        ///< Current day
+    CampaignStrategy& m_strategy; ///< Decision maker
+    
+    /**
+     * @brief Plays the worker allocation of one day
+     */
+    void playDay();
+    
+    /**
+     * @brief Applies one counter visit with the same rules as the counters
+     * @param action Visit to apply
+     * @return int Number of workers the visit assigned
+     */
+    int applyAction(const CampaignAction& action);
+    
+    /**
+     * @brief Plays the Thursday wave
+     * @return true if the player survives
+     */
+    bool fight();
+    
+    /**
+     * @brief Builds the result for the current state
+     * @param outcome How the campaign ended
+     * @return CampaignResult Final state
+     */
+    CampaignResult finish(CampaignOutcome outcome) const;
+};
@@ -10,10 +10,10 @@
 #include "../Counters/CounterFactory.h"
 #include "../UI/Animation.h"
 #include "../UI/Terminal.h"
+#include "../UI/InputSource.h"
 #include "../Utils/Constants.h"
 #include "../UI/UI.h"
 #include "../Utils/SpecialFunctions.h"
-#include <thread>
 #include <iostream>
 
 /**
@@ -65,7 +65,7 @@ void Game::initNewGame() {
     );
     m_weekCycle = WeekCycle();
     Animation::PlaySequence("anim/Loading", 70);
-    std::this_thread::sleep_for(std::chrono::seconds(1));
+    Animation::Pause(std::chrono::seconds(1));
 }
 
 /**
@@ -81,28 +81,28 @@ void Game::processMainMenu() {
     UI::WaitForEnter("Press Enter to start...");
 
     Animation::PlaySequence("anim/Title", 40);
-    std::this_thread::sleep_for(std::chrono::seconds(1));
+    Animation::Pause(std::chrono::seconds(1));
 
     int selectedOption = 0; // 0 for Play Game, 1 for Quit
     bool selectionMade = false;
 
     while (!selectionMade) {
-        Terminal::GetInstance().Clear();
-        
         switch (selectedOption) {
             case 0: UI::ShowInterface("ui/Menu/menu_play.txt"); break;
             case 1: UI::ShowInterface("ui/Menu/menu_quit.txt"); break;
         }
         
-        char input = Terminal::GetInstance().GetKeyPress();
+        int input = Terminal::GetInstance().GetKeyPress();
         
         switch (input) {
             case 'w':
             case 'W':
+            case InputSource::KEY_UP:
                 selectedOption = 0;
                 break;
             case 's':
             case 'S':
+            case InputSource::KEY_DOWN:
                 selectedOption = 1;
                 break;
             case '\n': // Enter key
@@ -128,23 +128,23 @@ void Game::processDifficultySelect() {
     bool selectionMade = false;
 
     while (!selectionMade) {
-        Terminal::GetInstance().Clear();
-        
         switch (selectedOption) {
             case 0: UI::ShowInterface("ui/Difficulty/difficulty_easy.txt"); break;
             case 1: UI::ShowInterface("ui/Difficulty/difficulty_medium.txt"); break;
             case 2: UI::ShowInterface("ui/Difficulty/difficulty_hard.txt"); break;
         }
                 
-        char input = Terminal::GetInstance().GetKeyPress();
+        int input = Terminal::GetInstance().GetKeyPress();
         
         switch (input) {
             case 'w':
             case 'W':
+            case InputSource::KEY_UP:
                 if (selectedOption > 0) selectedOption--;
                 break;
             case 's':
             case 'S':
+            case InputSource::KEY_DOWN:
                 if (selectedOption < 2) selectedOption++;
                 break;
             case '\n': // Enter key
@@ -173,23 +173,23 @@ void Game::processDay() {
     if (m_weekCycle.getCurrentDay() == 1) {
         UI::ShowInterface("ui/empty.txt");
         Animation::TypewriterInBox("The year is 2025.", 50, 10);
-        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        Animation::Pause(std::chrono::milliseconds(500));
         Animation::TypewriterInBox("A zombie outbreak has ravaged HKU, and you must lead a group of survivors", 50, 13);
         Animation::TypewriterInBox("to gather resources, fortify defenses, and endure relentless Thursday hordes. ", 50, 15);
-        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        Animation::Pause(std::chrono::milliseconds(500));
         Animation::TypewriterInBox("Every day brings critical choices ———— shop for upgrades, farm for food,", 50, 18);
         Animation::TypewriterInBox("mine for gold, recruiting center, or risk expeditions into the wasteland.", 50, 20);
-        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        Animation::Pause(std::chrono::milliseconds(500));
         Animation::TypewriterInBox("Will you last long enough for rescue... or fall to the undead?", 100, 23);
-        std::this_thread::sleep_for(std::chrono::seconds(2));
+        Animation::Pause(std::chrono::seconds(2));
         UI::WaitForEnter("Press Enter to continue...");
         UI::ShowInterface("ui/empty.txt");
         Animation::TypewriterInBox("Now, let's start the first day.", 50, 15);
-        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        Animation::Pause(std::chrono::milliseconds(500));
         Animation::TypewriterInBox("Today is ......", 50, 18);
-        std::this_thread::sleep_for(std::chrono::milliseconds(1500));
+        Animation::Pause(std::chrono::milliseconds(1500));
         UI::ShowInterface("ui/Days/Friday1.txt");
-        std::this_thread::sleep_for(std::chrono::seconds(2));
+        Animation::Pause(std::chrono::seconds(2));
         UI::WaitForEnter("Press Enter to continue...");
     } else {
         UI::ShowDayTransition(m_weekCycle.getDayName(), m_weekCycle.getCurrentWeek());
@@ -233,8 +233,6 @@ void Game::handleCounterAction() {
     bool selectionMade = false;
 
     while (!selectionMade) {
-        Terminal::GetInstance().Clear();
-        
         switch (selectedOption) {
             case 0: UI::ShowInterface("ui/Home/home_mining.txt");
                     break;
@@ -248,19 +246,22 @@ void Game::handleCounterAction() {
                     break;
         }
         
-        char input = Terminal::GetInstance().GetKeyPress();
+        int input = Terminal::GetInstance().GetKeyPress();
         
         switch (input) {
             case 'w':
             case 'W':
+            case InputSource::KEY_UP:
                 if (selectedOption > 2) selectedOption -= 3; // Move up
                 break;
             case 's':
             case 'S':
+            case InputSource::KEY_DOWN:
                 if (selectedOption < 3 && selectedOption != 1) selectedOption += 3; // Move down
                 break;
             case 'a':
             case 'A':
+            case InputSource::KEY_LEFT:
                 if (selectedOption > 0) {
                     if (selectedOption == 5) selectedOption = 3; // Direct path from 5 to 3
                     else if (selectedOption != 3) selectedOption--; // Normal left movement
@@ -268,6 +269,7 @@ void Game::handleCounterAction() {
                 break;
             case 'd':
             case 'D':
+            case InputSource::KEY_RIGHT:
                 if (selectedOption < 2) selectedOption++; // Normal right movement in first row
                 else if (selectedOption == 3) selectedOption = 5; // Direct path from 3 to 5
                 else if (selectedOption != 5 && selectedOption != 2) selectedOption++; // Normal right movement
@@ -321,17 +323,17 @@ void Game::triggerCombat() {
 
     UI::ShowInterface("ui/empty.txt");
     Animation::TypewriterInBox("You are under attack by a horde of zombies! ! !", 50, 13);
-    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    Animation::Pause(std::chrono::milliseconds(500));
 
     Animation::TypewriterInBox("You must defend your home! ! !", 50, 15);
-    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    Animation::Pause(std::chrono::milliseconds(500));
 
     Animation::TypewriterInBox("The horde is approaching ......", 100, 17);
-    std::this_thread::sleep_for(std::chrono::seconds(1));
+    Animation::Pause(std::chrono::seconds(1));
     UI::WaitForEnter("Press Enter to continue...");
 
     Animation::PlaySequence("anim/Protect", 100);
-    std::this_thread::sleep_for(std::chrono::seconds(2));
+    Animation::Pause(std::chrono::seconds(2));
     Animation::PlaySequence("anim/Fight", 150);
     UI::WaitForEnter("Press Enter to start fight...");
 
@@ -359,24 +361,24 @@ void Game::showEndScreen(bool victory) {
     if (victory) {
         UI::ShowInterface("ui/empty.txt");
         Animation::TypewriterInBox("Congratulations! You have survived the zombie apocalypse!", 50, 13);
-        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        Animation::Pause(std::chrono::milliseconds(500));
         Animation::TypewriterInBox("The rescue team is coming soon.", 50, 15);
-        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        Animation::Pause(std::chrono::milliseconds(500));
         Animation::TypewriterInBox("You have saved HKU!", 50, 18);
-        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        Animation::Pause(std::chrono::milliseconds(500));
         Animation::TypewriterInBox("Thank you for your bravery, my hero!", 50, 20);
-        std::this_thread::sleep_for(std::chrono::milliseconds(1500));
+        Animation::Pause(std::chrono::milliseconds(1500));
         UI::WaitForEnter("Press Enter to quit...");
     } else {
         UI::ShowInterface("ui/empty.txt");
         Animation::TypewriterInBox("Sorry, you have no people left.", 50, 15);
-        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        Animation::Pause(std::chrono::milliseconds(500));
         Animation::TypewriterInBox("You have failed to survive the zombie apocalypse.", 50, 18);
-        std::this_thread::sleep_for(std::chrono::milliseconds(1500));
+        Animation::Pause(std::chrono::milliseconds(1500));
         Animation::PlaySequence("anim/Lose1", 80);
         UI::WaitForEnter("Press Enter to quit...");
         Animation::PlaySequence("anim/Lose2", 100);
-        std::this_thread::sleep_for(std::chrono::seconds(1));
+        Animation::Pause(std::chrono::seconds(1));
     }
     m_state = GameState::GAME_OVER;
 }
\ No newline at end of file
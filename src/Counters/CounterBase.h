@@ -9,7 +9,7 @@
  * The CounterBase class defines:
  * - Basic counter properties (name, player reference)
  * - Common interface methods (OnEnter, Process, OnExit)
- * - Key callback management
+ * - Hot key bindings, pushed onto the Terminal while the counter is open
  * - Player information display
  * 
  * @see FarmingCounter
@@ -24,6 +24,7 @@
 #include <string>
 #include "../UI/Terminal.h"
 #include "../UI/UI.h"
+#include "../UI/KeyMap.h"
 #include <stdexcept>
 
 /**
@@ -47,6 +48,7 @@ class CounterBase {
 protected:
     Player& m_player;       // Reference to the player object
     std::string m_name;     // Name of the counter
+    KeyMap m_keyMap;        // Hot keys active while the counter is open
 
     /**
      * @brief Static function to trigger return to home menu
@@ -63,7 +65,9 @@ public:
      * @param name Name of the counter
      */
     CounterBase(Player& player, const std::string& name)
-        : m_player(player), m_name(name) {}
+        : m_player(player), m_name(name) {
+        m_keyMap.Bind('h', returnToHome);
+    }
     
     /**
      * @brief Virtual destructor to ensure proper cleanup of derived classes
@@ -95,61 +99,18 @@ public:
     const std::string& GetName() const;
 
     /**
-     * @brief Set up the 'H' key callback to return to home menu
+     * @brief Makes the counter's hot keys active
+     * H returns to the home menu; derived counters bind their own keys
+     * into m_keyMap in their constructors
      */
-    void setupHKeyCallback() {
-        Terminal::GetInstance().SetHKeyCallback(returnToHome);
+    void pushKeyBindings() {
+        Terminal::GetInstance().PushKeyMap(m_keyMap);
     }
     
     /**
-     * @brief Clear the 'H' key callback
-     */
-    void clearHKeyCallback() {
-        Terminal::GetInstance().ClearHKeyCallback();
-    }
-
-    /**
-     * @brief Set up the 'W' key callback
-     * @param callback Function pointer to the callback function
-     */
-    void setupWKeyCallback(void (*callback)()) {
-        Terminal::GetInstance().SetWKeyCallback(callback);
-    }
-
-    /**
-     * @brief Clear the 'W' key callback
-     */
-    void clearWKeyCallback() {
-        Terminal::GetInstance().ClearWKeyCallback();
-    }
-
-    /**
-     * @brief Set up the 'L' key callback
-     * @param callback Function pointer to the callback function
-     */
-    void setupLKeyCallback(void (*callback)()) {
-        Terminal::GetInstance().SetLKeyCallback(callback);
-    }
-
-    /**
-     * @brief Clear the 'L' key callback
-     */
-    void clearLKeyCallback() {
-        Terminal::GetInstance().ClearLKeyCallback();
-    }
-
-    /**
-     * @brief Set up the 'Q' key callback
-     * @param callback Function pointer to the callback function
-     */
-    void setupQKeyCallback(void (*callback)()) {
-        Terminal::GetInstance().SetQKeyCallback(callback);
-    }
-
-    /**
-     * @brief Clear the 'Q' key callback
+     * @brief Deactivates the counter's hot keys
      */
-    void clearQKeyCallback() {
-        Terminal::GetInstance().ClearQKeyCallback();
+    void popKeyBindings() {
+        Terminal::GetInstance().PopKeyMap();
     }
 };
\ No newline at end of file
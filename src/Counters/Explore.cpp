@@ -17,44 +17,38 @@
 #include <iostream>
 #include <string>
 #include <vector>
-#include <thread>
 #include <chrono>
 
-// Initialize static member
-ExploreCounter* ExploreCounter::currentInstance = nullptr;
-
 /**
  * @brief Constructor for ExploreCounter
  * @param player Reference to the player object
  * @param weekCycle Reference to the week cycle system
  * 
  * Initializes the exploration counter with player and week cycle references,
- * and sets up the current instance pointer.
+ * and binds its hot keys.
  */
 ExploreCounter::ExploreCounter(Player& player, WeekCycle& weekCycle) 
     : CounterBase(player, "Explore"), m_weekCycle(weekCycle) {
-    currentInstance = this;
+    m_keyMap.Bind('l', [this] { ShowPlayerInfo(); });
+    m_keyMap.Bind('q', [this] { ShowQuitMessage(); });
 }
 
 /**
  * @brief Called when entering the exploration system
  * 
- * Sets up key callbacks and displays the initial exploration interface
+ * Activates the hot keys and displays the initial exploration interface
  * with animated introduction text.
  */
 void ExploreCounter::OnEnter() {
-    // Set up key callbacks
-    setupHKeyCallback();
-    setupLKeyCallback(ShowPlayerInfoCallback);
-    setupQKeyCallback(ShowQuitMessageCallback);
+    pushKeyBindings();
     
     UI::ShowInterface("ui/Counters/Explore/explore1.txt");
-    Animation::TypewriterInBox("Step into this land, and ahead lies the mysterious and uncharted territory,", 50, 16);
-    std::this_thread::sleep_for(std::chrono::milliseconds(500));
-    Animation::TypewriterInBox("fraught with perils yet hiding endless treasures,", 50, 17);
-    std::this_thread::sleep_for(std::chrono::milliseconds(500));
-    Animation::TypewriterInBox("where high risks and high rewards go hand in hand ~", 50, 18);
-    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    Animation::TypewriterGroup intro;
+    intro.Add("Step into this land, and ahead lies the mysterious and uncharted territory,", 16);
+    intro.Add("fraught with perils yet hiding endless treasures,", 17, std::chrono::milliseconds(600));
+    intro.Add("where high risks and high rewards go hand in hand ~", 18, std::chrono::milliseconds(1200));
+    intro.Play();
+    Animation::Pause(std::chrono::milliseconds(500));
     UI::WaitForEnter();
 }
 
@@ -72,19 +66,19 @@ void ExploreCounter::Process() {
     
     if (peopleSent > 0) {
         m_player.assignWorkers(0, 0, 0, 0, peopleSent);
-        ExploreResult result = executeExplore();
+        ExploreResult result = executeExplore(m_player);
         int value = 0;
-        applyResult(result, peopleSent, value);
+        applyResult(m_player, result, peopleSent, value);
         
         UI::WaitForEnter();
         // Display exploration in progress message with typewriter effect
         UI::ShowInterface("ui/Counters/Explore/explore1.txt");
         Animation::TypewriterInBox("Your guys are exploring the land, which is full of perils and treasures!", 50, 16);
-        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        Animation::Pause(std::chrono::milliseconds(500));
         Animation::TypewriterInBox("Will they return with treasures or in pieces?", 50, 17);
-        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        Animation::Pause(std::chrono::milliseconds(500));
         Animation::TypewriterInBox("Let's pray for them ......", 50, 18);
-        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        Animation::Pause(std::chrono::milliseconds(500));
         UI::WaitForEnter();
 
         // Display results with typewriter effect
@@ -92,7 +86,7 @@ void ExploreCounter::Process() {
         UI::ShowInterface("ui/Counters/Explore/explore2.txt");
         UI::DisplayCenterText(messages[0], 23);
         UI::DisplayCenterText(messages[1], 25);
-        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        Animation::Pause(std::chrono::milliseconds(500));
     }
     
     UI::WaitForEnter("Press Enter to return to home...");
@@ -101,39 +95,35 @@ void ExploreCounter::Process() {
 /**
  * @brief Called when exiting the exploration system
  * 
- * Cleans up by removing all key callbacks and resetting the current instance pointer.
+ * Deactivates the hot keys.
  */
 void ExploreCounter::OnExit() {
-    // Clear all callbacks
-    clearHKeyCallback();
-    clearLKeyCallback();
-    clearQKeyCallback();
-    // Clear current instance
-    currentInstance = nullptr;
+    popKeyBindings();
 }
 
 // --- Private method implementations ---
 
 /**
  * @brief Execute the core exploration logic
+ * @param player Player whose difficulty sets the risk
  * @return ExploreResult indicating the outcome of exploration
  * 
  * Determines the exploration outcome based on:
  * 1. Difficulty-based loss probability
  * 2. Random distribution of rewards (gold:crops:people:nothing = 2:2:2:1)
  */
-ExploreCounter::ExploreResult ExploreCounter::executeExplore() {
+ExploreCounter::ExploreResult ExploreCounter::executeExplore(const Player& player) {
     // Get difficulty configuration
-    const float lossProbability = Difficulty::GetConfig(m_player.getStringDifficulty()).exploreRisk;
+    const float lossProbability = Difficulty::GetConfig(player.getStringDifficulty()).exploreRisk;
 
     // Check if people are lost
-    if (Random::Chance(lossProbability)) {
+    if (Random::Chance(lossProbability, Random::Stream::EXPLORE)) {
         return ExploreResult::PEOPLE_LOST;
     }
 
     // If not lost, distribute probability according to 2:2:2:1 ratio
     float remainingProbability = (1.0f - lossProbability) / 7.0f; // Total parts = 2+2+2+1 = 7
-    float randomValue = Random::RangeReal(0.0f, 1.0f);
+    float randomValue = Random::RangeReal(0.0f, 1.0f, Random::Stream::EXPLORE);
 
     if (randomValue < 2 * remainingProbability) {
         return ExploreResult::GOLD_FOUND;
@@ -148,6 +138,7 @@ ExploreCounter::ExploreResult ExploreCounter::executeExplore() {
 
 /**
  * @brief Apply the results of exploration to the game state
+ * @param player Player whose resources change
  * @param result The exploration result
  * @param peopleSent Number of people sent on exploration
  * @param value Reference to store the reward value
@@ -159,26 +150,26 @@ ExploreCounter::ExploreResult ExploreCounter::executeExplore() {
  * - People lost: Removes people
  * - Nothing found: No changes
  */
-void ExploreCounter::applyResult(ExploreResult result, int peopleSent, int& value) {
+void ExploreCounter::applyResult(Player& player, ExploreResult result, int peopleSent, int& value) {
     switch (result) {
         case ExploreResult::GOLD_FOUND:
-            value = Random::Range(MIN_GOLD_REWARD, MAX_GOLD_REWARD) * peopleSent;
-            m_player.addGold(value);
+            value = Random::Range(MIN_GOLD_REWARD, MAX_GOLD_REWARD, Random::Stream::LOOT) * peopleSent;
+            player.addGold(value);
             break;
             
         case ExploreResult::CROP_FOUND:
-            value = Random::Range(MIN_CROP_REWARD, MAX_CROP_REWARD) * peopleSent;
-            m_player.addCrop(value);
+            value = Random::Range(MIN_CROP_REWARD, MAX_CROP_REWARD, Random::Stream::LOOT) * peopleSent;
+            player.addCrop(value);
             break;
             
         case ExploreResult::PEOPLE_JOINED:
-            value = Random::Range(MIN_PEOPLE_REWARD, MAX_PEOPLE_REWARD);
-            m_player.addPeople(value);
+            value = Random::Range(MIN_PEOPLE_REWARD, MAX_PEOPLE_REWARD, Random::Stream::LOOT);
+            player.addPeople(value);
             break;
             
         case ExploreResult::PEOPLE_LOST:
             value = peopleSent; // Lost all exploration members
-            m_player.addPeople(-value);
+            player.addPeople(-value);
             break;
             
         case ExploreResult::NOTHING_FOUND:
@@ -227,17 +218,6 @@ std::vector<std::string> ExploreCounter::showResultMessage(ExploreResult result,
     return messages;
 }
 
-/**
- * @brief Static callback for showing player information
- * 
- * Called when 'L' key is pressed to display player stats.
- */
-void ExploreCounter::ShowPlayerInfoCallback() {
-    if (currentInstance) {
-        currentInstance->ShowPlayerInfo();
-    }
-}
-
 /**
  * @brief Display player information and restore exploration interface
  * 
@@ -276,28 +256,17 @@ int ExploreCounter::getValidPeopleInput(int max) {
     
         if (input >= 0 && input <= max) {
             UI::DisplayCenterText("Successfully assigned " + std::to_string(input)  + " people to explore!", 27);
-            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+            Animation::Pause(std::chrono::milliseconds(1000));
             return input;
         }
         else {
             UI::DisplayCenterText("Invalid input! Must be between 0 and " + std::to_string(max) + "!", 27);
-            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+            Animation::Pause(std::chrono::milliseconds(1000));
             UI::WaitForEnter("Press Enter to try again...");
         }
     }
 }
 
-/**
- * @brief Static callback for showing quit message
- * 
- * Called when 'Q' key is pressed to display quit confirmation.
- */
-void ExploreCounter::ShowQuitMessageCallback() {
-    if (currentInstance) {
-        currentInstance->ShowQuitMessage();
-    }
-}
-
 /**
  * @brief Display quit message and restore exploration interface
  * 
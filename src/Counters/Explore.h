@@ -37,20 +37,15 @@
  */
 class ExploreCounter : public CounterBase {
 private:
-    // Pointer to the current ExploreCounter instance
-    static ExploreCounter* currentInstance;
-    
     /**
      * @brief Display player's current information
      */
     void ShowPlayerInfo();
-    static void ShowPlayerInfoCallback();
 
     /**
      * @brief Display quit message when player wants to exit
      */
     void ShowQuitMessage();
-    static void ShowQuitMessageCallback();
 
     // Reference to the week cycle system
     WeekCycle& m_weekCycle;
@@ -78,7 +73,6 @@ public:
      */
     void OnExit() override;
 
-private:
     /**
      * @brief Enum representing possible exploration outcomes
      */
@@ -90,30 +84,33 @@ private:
         NOTHING_FOUND,     // No significant findings
     };
 
-    // Configuration table for difficulty levels
-    static const std::unordered_map<int, float> DIFFICULTY_CONFIGS;
-
-    // Reward range constants
-    static constexpr int MIN_GOLD_REWARD = 10;    // Minimum gold reward
-    static constexpr int MAX_GOLD_REWARD = 50;    // Maximum gold reward
-    static constexpr int MIN_CROP_REWARD = 10;    // Minimum crop reward
-    static constexpr int MAX_CROP_REWARD = 50;    // Maximum crop reward
-    static constexpr int MIN_PEOPLE_REWARD = 1;   // Minimum people reward
-    static constexpr int MAX_PEOPLE_REWARD = 3;   // Maximum people reward
-
     /**
      * @brief Execute the core exploration logic
+     * @param player Player whose difficulty sets the risk
      * @return ExploreResult indicating the outcome of exploration
      */
-    ExploreResult executeExplore();
+    static ExploreResult executeExplore(const Player& player);
     
     /**
      * @brief Apply the results of exploration to the game state
+     * @param player Player whose resources change
      * @param result The exploration result
      * @param peopleSent Number of people sent on exploration
      * @param value Reference to store the reward value
      */
-    void applyResult(ExploreResult result, int peopleSent, int& value);
+    static void applyResult(Player& player, ExploreResult result, int peopleSent, int& value);
+
+private:
+    // Configuration table for difficulty levels
+    static const std::unordered_map<int, float> DIFFICULTY_CONFIGS;
+
+    // Reward range constants
+    static constexpr int MIN_GOLD_REWARD = 10;    // Minimum gold reward
+    static constexpr int MAX_GOLD_REWARD = 50;    // Maximum gold reward
+    static constexpr int MIN_CROP_REWARD = 10;    // Minimum crop reward
+    static constexpr int MAX_CROP_REWARD = 50;    // Maximum crop reward
+    static constexpr int MIN_PEOPLE_REWARD = 1;   // Minimum people reward
+    static constexpr int MAX_PEOPLE_REWARD = 3;   // Maximum people reward
 
     /**
      * @brief Generate result messages for the UI
@@ -13,43 +13,37 @@
 #include "../Core/Difficulty.h"
 #include "../Utils/SpecialFunctions.h"
 #include <iostream>
-#include <thread>
 #include <chrono>
 
-// Initialize static member
-FarmingCounter* FarmingCounter::currentInstance = nullptr;
-
 /**
  * @brief Constructor for FarmingCounter
  * @param player Reference to the player object
  * @param weekCycle Reference to the week cycle system
  * 
  * Initializes the farming counter with player and week cycle references,
- * and sets up the current instance pointer.
+ * and binds its hot keys.
  */
 FarmingCounter::FarmingCounter(Player& player, WeekCycle& weekCycle) 
     : CounterBase(player, "Farming"), m_weekCycle(weekCycle) {
-    currentInstance = this;
+    m_keyMap.Bind('l', [this] { ShowPlayerInfo(); });
+    m_keyMap.Bind('q', [this] { ShowQuitMessage(); });
 }
 
 /**
  * @brief Called when entering the farming system
  * 
- * Sets up key callbacks and displays the initial farming interface
+ * Activates the hot keys and displays the initial farming interface
  * with animated introduction text.
  */
 void FarmingCounter::OnEnter() {
-    // Set up key callbacks
-    setupHKeyCallback();
-    setupLKeyCallback(ShowPlayerInfoCallback);
-    setupQKeyCallback(ShowQuitMessageCallback);
+    pushKeyBindings();
     
     UI::ShowInterface("ui/Counters/Farming/farming1.txt");
-    Animation::TypewriterInBox("Welcome to my farm, guys.", 50, 26);
-    std::this_thread::sleep_for(std::chrono::milliseconds(500));
-
-    Animation::TypewriterInBox("It's time to work hard for your survival.", 50, 27);
-    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    Animation::TypewriterGroup intro;
+    intro.Add("Welcome to my farm, guys.", 26);
+    intro.Add("It's time to work hard for your survival.", 27, std::chrono::milliseconds(600));
+    intro.Play();
+    Animation::Pause(std::chrono::milliseconds(500));
     UI::WaitForEnter();
 }
 
@@ -74,14 +68,14 @@ void FarmingCounter::Process() {
         // Display farming in progress message with typewriter effect
         UI::ShowInterface("ui/Counters/Farming/farming3.txt");
         Animation::TypewriterInBox("Your guys are working hard to harvest more crops!", 50, 31);
-        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        Animation::Pause(std::chrono::milliseconds(500));
         UI::WaitForEnter();
 
         // Display results with typewriter effect
         UI::ShowInterface("ui/Counters/Farming/farming2.txt");
         UI::DisplayCenterText("You got " + std::to_string(yield * workers) + " crops!", 25);
         UI::DisplayCenterText("You can use the crops to recruit new members and grow your team!", 27);
-        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        Animation::Pause(std::chrono::milliseconds(500));
     }
     
     UI::WaitForEnter("Press Enter to return to home...");
@@ -90,26 +84,10 @@ void FarmingCounter::Process() {
 /**
  * @brief Called when exiting the farming system
  * 
- * Cleans up by removing all key callbacks and resetting the current instance pointer.
+ * Deactivates the hot keys.
  */
 void FarmingCounter::OnExit() {
-    // Clear all callbacks
-    clearHKeyCallback();
-    clearLKeyCallback();
-    clearQKeyCallback();
-    // Clear current instance
-    currentInstance = nullptr;
-}
-
-/**
- * @brief Static callback for showing player information
- * 
- * Called when 'L' key is pressed to display player stats.
- */
-void FarmingCounter::ShowPlayerInfoCallback() {
-    if (currentInstance) {
-        currentInstance->ShowPlayerInfo();
-    }
+    popKeyBindings();
 }
 
 /**
@@ -128,17 +106,6 @@ void FarmingCounter::ShowPlayerInfo() {
     UI::DisplayCenterText("Assign farmers (0-" + std::to_string(m_player.getAvailablePeople()) + "): ", 27);
 }
 
-/**
- * @brief Static callback for showing quit message
- * 
- * Called when 'Q' key is pressed to display quit confirmation.
- */
-void FarmingCounter::ShowQuitMessageCallback() {
-    if (currentInstance) {
-        currentInstance->ShowQuitMessage();
-    }
-}
-
 /**
  * @brief Display quit message and restore farming interface
  * 
@@ -175,12 +142,12 @@ int FarmingCounter::GetValidInput(int max) {
     
         if (input >= 0 && input <= max) {
             UI::DisplayCenterText("Successfully assigned " + std::to_string(input) + " farmers!", 28);
-            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+            Animation::Pause(std::chrono::milliseconds(1000));
             return input;
         }
         else {
             UI::DisplayCenterText("Invalid input! Must be between 0 and " + std::to_string(max) + "!", 28);
-            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+            Animation::Pause(std::chrono::milliseconds(1000));
             UI::WaitForEnter("Press Enter to try again...");
         }
     }
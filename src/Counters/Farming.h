@@ -39,20 +39,15 @@ private:
      */
     int GetValidInput(int max);
     
-    // Pointer to the current FarmingCounter instance
-    static FarmingCounter* currentInstance;
-    
     /**
      * @brief Display player's current information
      */
     void ShowPlayerInfo();
-    static void ShowPlayerInfoCallback();
 
     /**
      * @brief Display quit message when player wants to exit
      */
     void ShowQuitMessage();
-    static void ShowQuitMessageCallback();
 
     // Reference to the week cycle system for seasonal effects
     WeekCycle& m_weekCycle;
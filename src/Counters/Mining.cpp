@@ -13,46 +13,39 @@
 #include "../Core/Difficulty.h"
 #include "../Utils/SpecialFunctions.h"
 #include <iostream>
-#include <thread>
 #include <chrono>
 
-// Initialize static member
-MiningCounter* MiningCounter::currentInstance = nullptr;
-
 /**
  * @brief Constructor for MiningCounter
  * @param player Reference to the player object
  * @param weekCycle Reference to the week cycle system
  * 
  * Initializes the mining counter with player and week cycle references,
- * and sets up the current instance pointer.
+ * and binds its hot keys.
  */
 MiningCounter::MiningCounter(Player& player, WeekCycle& weekCycle) 
     : CounterBase(player, "Mining"), m_weekCycle(weekCycle) {
-    currentInstance = this;
+    m_keyMap.Bind('l', [this] { ShowPlayerInfo(); });
+    m_keyMap.Bind('q', [this] { ShowQuitMessage(); });
 }
 
 /**
  * @brief Called when entering the mining system
  * 
- * Sets up key callbacks and displays the initial mining interface
+ * Activates the hot keys and displays the initial mining interface
  * with animated introduction text.
  */
 void MiningCounter::OnEnter() {
-    // Set up key callbacks
-    setupHKeyCallback();
-    setupLKeyCallback(ShowPlayerInfoCallback);
-    setupQKeyCallback(ShowQuitMessageCallback);
+    pushKeyBindings();
     
     UI::ShowInterface("ui/Counters/Mining/mining1.txt");
-    Animation::TypewriterInBox("Oh! My dear owner, ", 50, 23);
-    std::this_thread::sleep_for(std::chrono::milliseconds(500));
-    Animation::TypewriterInBox("I've been waiting for you here for a long time!", 50, 24);
-    std::this_thread::sleep_for(std::chrono::milliseconds(500));
-    Animation::TypewriterInBox("The gold mine seems to have brightened up with your arrival.", 50, 25);
-    std::this_thread::sleep_for(std::chrono::milliseconds(500));
-    Animation::TypewriterInBox("I'll lead the way for you right away.", 50, 26);
-    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    Animation::TypewriterGroup intro;
+    intro.Add("Oh! My dear owner, ", 23);
+    intro.Add("I've been waiting for you here for a long time!", 24, std::chrono::milliseconds(600));
+    intro.Add("The gold mine seems to have brightened up with your arrival.", 25, std::chrono::milliseconds(1200));
+    intro.Add("I'll lead the way for you right away.", 26, std::chrono::milliseconds(1800));
+    intro.Play();
+    Animation::Pause(std::chrono::milliseconds(500));
     UI::WaitForEnter();
 }
 
@@ -77,14 +70,14 @@ void MiningCounter::Process() {
         // Display mining in progress message with typewriter effect
         UI::ShowInterface("ui/Counters/Mining/mining3.txt");
         Animation::TypewriterInBox("Your guys are working hard to get more golds!", 50, 23);
-        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        Animation::Pause(std::chrono::milliseconds(500));
         UI::WaitForEnter();
 
         // Display results with typewriter effect
         UI::ShowInterface("ui/Counters/Mining/mining2.txt");
         UI::DisplayCenterText("You got " + std::to_string(yield * workers) + " golds!", 24);
         UI::DisplayCenterText("You can use the golds to upgrade your weapons and defend yourself against the zombies!", 26);
-        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        Animation::Pause(std::chrono::milliseconds(500));
     }
     
     UI::WaitForEnter("Press Enter to return to home...");
@@ -93,26 +86,10 @@ void MiningCounter::Process() {
 /**
  * @brief Called when exiting the mining system
  * 
- * Cleans up by removing all key callbacks and resetting the current instance pointer.
+ * Deactivates the hot keys.
  */
 void MiningCounter::OnExit() {
-    // Clear all callbacks
-    clearHKeyCallback();
-    clearLKeyCallback();
-    clearQKeyCallback();
-    // Clear current instance
-    currentInstance = nullptr;
-}
-
-/**
- * @brief Static callback for showing player information
- * 
- * Called when 'L' key is pressed to display player stats.
- */
-void MiningCounter::ShowPlayerInfoCallback() {
-    if (currentInstance) {
-        currentInstance->ShowPlayerInfo();
-    }
+    popKeyBindings();
 }
 
 /**
@@ -151,28 +128,17 @@ int MiningCounter::GetValidInput(int max) {
     
         if (input >= 0 && input <= max) {
             UI::DisplayCenterText("Successfully assigned " + std::to_string(input) + " miners!", 28);
-            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+            Animation::Pause(std::chrono::milliseconds(1000));
             return input;
         }
         else {
             UI::DisplayCenterText("Invalid input! Must be between 0 and " + std::to_string(max) + "!", 28);
-            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+            Animation::Pause(std::chrono::milliseconds(1000));
             UI::WaitForEnter("Press Enter to try again...");
         }
     }
 }
 
-/**
- * @brief Static callback for showing quit message
- * 
- * Called when 'Q' key is pressed to display quit confirmation.
- */
-void MiningCounter::ShowQuitMessageCallback() {
-    if (currentInstance) {
-        currentInstance->ShowQuitMessage();
-    }
-}
-
 /**
  * @brief Display quit message and restore mining interface
  * 
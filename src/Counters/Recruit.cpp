@@ -10,14 +10,10 @@
 #include "../UI/Terminal.h"
 #include "../Core/Player.h"
 #include <iostream>
-#include <thread>
 #include <chrono>
 #include "../UI/Animation.h"
 #include "../Utils/SpecialFunctions.h"
 
-// Initialize static member
-RecruitCounter* RecruitCounter::currentInstance = nullptr;
-
 /**
  * @brief Constructor for RecruitCounter
  * @param player Reference to the player object
@@ -28,29 +24,27 @@ RecruitCounter* RecruitCounter::currentInstance = nullptr;
  */
 RecruitCounter::RecruitCounter(Player& player, WeekCycle& weekCycle) 
     : CounterBase(player, "Recruit"), m_weekCycle(weekCycle), m_currentState(InputState::WAITING_YN) {
-    currentInstance = this;
+    m_keyMap.Bind('l', [this] { ShowPlayerInfo(); });
+    m_keyMap.Bind('q', [this] { ShowQuitMessage(); });
 }
 
 /**
  * @brief Called when entering the recruitment system
  * 
- * Sets up key callbacks and displays the initial recruitment interface
+ * Activates the hot keys and displays the initial recruitment interface
  * with animated introduction text.
  */
 void RecruitCounter::OnEnter() {
-    // Set up key callbacks
-    setupHKeyCallback();
-    setupLKeyCallback(ShowPlayerInfoCallback);
-    setupQKeyCallback(ShowQuitMessageCallback);
+    pushKeyBindings();
     
     // Display introduction with typewriter effect
     UI::ShowInterface("ui/Counters/Recruit/recruit1.txt");
-    Animation::TypewriterInBox("Hey! Come to hire someone, huh?", 50, 26);
-    std::this_thread::sleep_for(std::chrono::milliseconds(500));
-    Animation::TypewriterInBox("Is the pay sweet enough?", 50, 27);
-    std::this_thread::sleep_for(std::chrono::milliseconds(500));
-    Animation::TypewriterInBox("I'll pick some capable ones for you.", 50, 28);
-    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    Animation::TypewriterGroup intro;
+    intro.Add("Hey! Come to hire someone, huh?", 26);
+    intro.Add("Is the pay sweet enough?", 27, std::chrono::milliseconds(600));
+    intro.Add("I'll pick some capable ones for you.", 28, std::chrono::milliseconds(1200));
+    intro.Play();
+    Animation::Pause(std::chrono::milliseconds(500));
     UI::WaitForEnter();
 }
 
@@ -64,7 +58,7 @@ void RecruitCounter::OnEnter() {
  * 4. Displaying results with animations
  */
 void RecruitCounter::Process() {
-    int maxRecruits = calculateMaxRecruits();
+    int maxRecruits = calculateMaxRecruits(m_player);
     if (maxRecruits <= 0) {
         UI::ShowInterface("ui/Counters/Recruit/recruit2.txt");
         UI::DisplayCenterText("No enough crops to recruit new members!", 25);
@@ -84,30 +78,19 @@ void RecruitCounter::Process() {
         UI::WaitForEnter();
         UI::ShowInterface("ui/Counters/Recruit/recruit3.txt");
         Animation::TypewriterInBox("Your soldiers are ready for fight!", 50, 25);
-        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        Animation::Pause(std::chrono::milliseconds(500));
         UI::WaitForEnter();
 
         // Display results with typewriter effect
         UI::ShowInterface("ui/Counters/Recruit/recruit2.txt");
         UI::DisplayCenterText("Now you have " + std::to_string(recruits) + " more members!", 25);
         UI::DisplayCenterText("Consumed crops: " + std::to_string(totalCost), 27);
-        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        Animation::Pause(std::chrono::milliseconds(500));
     }
     
     UI::WaitForEnter("Press Enter to return to home...");
 }
 
-/**
- * @brief Static callback for showing player information
- * 
- * Called when 'L' key is pressed to display player stats.
- */
-void RecruitCounter::ShowPlayerInfoCallback() {
-    if (currentInstance) {
-        currentInstance->ShowPlayerInfo();
-    }
-}
-
 /**
  * @brief Display player information and restore recruitment interface
  * 
@@ -125,7 +108,7 @@ void RecruitCounter::ShowPlayerInfo() {
         UI::DisplayCenterText("Do you want to assign one of your workers to recruit new members? [y/n] ", 26);
     } else {
         UI::DisplayCenterText("Do you want to assign one of your workers to recruit new members? [y/n] y", 26);
-        UI::DisplayCenterText("Recruit how many members? (0-" + std::to_string(calculateMaxRecruits()) + "): ", 28);
+        UI::DisplayCenterText("Recruit how many members? (0-" + std::to_string(calculateMaxRecruits(m_player)) + "): ", 28);
     }
 }
 
@@ -149,7 +132,7 @@ int RecruitCounter::GetValidInput(int max) {
         char yn = Terminal::GetInstance().GetYN();
         if (yn != 'y' && yn != 'Y' && yn != 'n' && yn != 'N'){
             UI::DisplayCenterText("Invalid input! Please enter y or n", 28);
-            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+            Animation::Pause(std::chrono::milliseconds(1000));
             UI::WaitForEnter("Press Enter to try again...");
             continue;
         }else if (yn == 'y' || yn == 'Y'){
@@ -162,17 +145,17 @@ int RecruitCounter::GetValidInput(int max) {
 
                 if (input >= 0 && input <= max) {
                     UI::DisplayCenterText("Successfully recruited " + std::to_string(input) + " members!", 29);
-                    std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+                    Animation::Pause(std::chrono::milliseconds(1000));
                     return input;
                 } else {
                     UI::DisplayCenterText("Must be between 0 and " + std::to_string(max) + "!", 29);
-                    std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+                    Animation::Pause(std::chrono::milliseconds(1000));
                     UI::WaitForEnter("Press Enter to try again...");
                 }
            }
         }else if (yn == 'n' || yn == 'N'){
             UI::DisplayCenterText("You will not recruit any member.", 28);
-            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+            Animation::Pause(std::chrono::milliseconds(1000));
             return 0;
         }
     }
@@ -180,6 +163,7 @@ int RecruitCounter::GetValidInput(int max) {
 
 /**
  * @brief Calculate maximum number of possible recruits
+ * @param player Player whose resources are checked
  * @return Maximum number of recruits based on available crops
  * 
  * Calculates how many recruits the player can afford based on:
@@ -187,19 +171,8 @@ int RecruitCounter::GetValidInput(int max) {
  * - Base cost
  * - Cost per member
  */
-int RecruitCounter::calculateMaxRecruits() const {
-    return std::max(0, (m_player.getCrop() - BASE_COST) / COST_PER_MEMBER);
-}
-
-/**
- * @brief Static callback for showing quit message
- * 
- * Called when 'Q' key is pressed to display quit confirmation.
- */
-void RecruitCounter::ShowQuitMessageCallback() {
-    if (currentInstance) {
-        currentInstance->ShowQuitMessage();
-    }
+int RecruitCounter::calculateMaxRecruits(const Player& player) {
+    return std::max(0, (player.getCrop() - BASE_COST) / COST_PER_MEMBER);
 }
 
 /**
@@ -219,20 +192,15 @@ void RecruitCounter::ShowQuitMessage() {
         UI::DisplayCenterText("Do you want to assign one of your workers to recruit new members? [y/n] ", 26);
     } else {
         UI::DisplayCenterText("Do you want to assign one of your workers to recruit new members? [y/n] y", 26);
-        UI::DisplayCenterText("Recruit how many members? (0-" + std::to_string(calculateMaxRecruits()) + "): ", 28);
+        UI::DisplayCenterText("Recruit how many members? (0-" + std::to_string(calculateMaxRecruits(m_player)) + "): ", 28);
     }
 }
 
 /**
  * @brief Called when exiting the recruitment system
  * 
- * Cleans up by removing all key callbacks and resetting the current instance pointer.
+ * Deactivates the hot keys.
  */
 void RecruitCounter::OnExit() {
-    // Clear all callbacks
-    clearHKeyCallback();
-    clearLKeyCallback();
-    clearQKeyCallback();
-    // Clear current instance
-    currentInstance = nullptr;
+    popKeyBindings();
 }
\ No newline at end of file
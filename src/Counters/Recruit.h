@@ -30,26 +30,30 @@
  * calculations and input validation for the recruitment process.
  */
 class RecruitCounter : public CounterBase {
-private:
+public:
     // Base cost for recruitment (can be modified by game mechanics)
     static constexpr int BASE_COST = 0;
     // Cost per person to recruit
     static constexpr int COST_PER_MEMBER = 30;
     
-    // Pointer to the current RecruitCounter instance
-    static RecruitCounter* currentInstance;
-    
+    /**
+     * @brief Calculate the maximum number of people that can be recruited
+     * based on available resources and other constraints
+     * @param player Player whose resources are checked
+     * @return Maximum number of people that can be recruited
+     */
+    static int calculateMaxRecruits(const Player& player);
+
+private:
     /**
      * @brief Display player's current information
      */
     void ShowPlayerInfo();
-    static void ShowPlayerInfoCallback();
 
     /**
      * @brief Display quit message when player wants to exit
      */
     void ShowQuitMessage();
-    static void ShowQuitMessageCallback();
 
     // Reference to the week cycle system
     WeekCycle& m_weekCycle;
@@ -70,13 +74,6 @@ private:
      */
     int GetValidInput(int max);
 
-    /**
-     * @brief Calculate the maximum number of people that can be recruited
-     * based on available resources and other constraints
-     * @return Maximum number of people that can be recruited
-     */
-    int calculateMaxRecruits() const;
-
 public:
     /**
      * @brief Constructor for RecruitCounter
@@ -10,48 +10,42 @@
 #include "../UI/UI.h"
 #include "../Core/Player.h"
 #include <iostream>
-#include <thread>
 #include <chrono>
 #include "../UI/Animation.h"
 #include "../Utils/SpecialFunctions.h"
 
-// Initialize static member
-ShopCounter* ShopCounter::currentInstance = nullptr;
-
 /**
  * @brief Constructor for ShopCounter
  * @param player Reference to the player object
  * @param weekCycle Reference to the week cycle system
  * 
- * Initializes the shop counter with player and week cycle references.
+ * Initializes the shop counter with player and week cycle references
+ * and binds its hot keys.
  */
 ShopCounter::ShopCounter(Player& player, WeekCycle& weekCycle) 
-    : CounterBase(player, "Shop"), m_weekCycle(weekCycle) {}
+    : CounterBase(player, "Shop"), m_weekCycle(weekCycle) {
+    m_keyMap.Bind('w', [this] { ShowWeaponPowerAndLevelInfo(); });
+    m_keyMap.Bind('l', [this] { ShowPlayerInfo(); });
+    m_keyMap.Bind('q', [this] { ShowQuitMessage(); });
+}
 
 /**
  * @brief Called when entering the shop system
  * 
- * Sets up key callbacks and displays the initial shop interface
+ * Activates the hot keys and displays the initial shop interface
  * with animated introduction text.
  */
 void ShopCounter::OnEnter() {
-    // Set up current instance
-    currentInstance = this;
-    // Set up key callbacks
-    setupHKeyCallback();
-    setupWKeyCallback(ShowWeaponPowerAndLevelInfoCallback);
-    setupLKeyCallback(ShowPlayerInfoCallback);
-    setupQKeyCallback(ShowQuitMessageCallback);
+    pushKeyBindings();
     
     UI::ShowInterface("ui/Counters/Shop/shop1.txt");
-    Animation::TypewriterInBox("Yo, what's up? Wanna upgrade your weapon?", 50, 24);
-    std::this_thread::sleep_for(std::chrono::milliseconds(500));
-    Animation::TypewriterInBox("Gotta see if you've got the skills and the dough.", 50, 25);
-    std::this_thread::sleep_for(std::chrono::milliseconds(500));
-    Animation::TypewriterInBox("That'll cost ya quite a lot of gold per level.", 50, 26);
-    std::this_thread::sleep_for(std::chrono::milliseconds(500));
-    Animation::TypewriterInBox("If you can't afford, don't waste my smoke time.", 50, 27);
-    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    Animation::TypewriterGroup intro;
+    intro.Add("Yo, what's up? Wanna upgrade your weapon?", 24);
+    intro.Add("Gotta see if you've got the skills and the dough.", 25, std::chrono::milliseconds(600));
+    intro.Add("That'll cost ya quite a lot of gold per level.", 26, std::chrono::milliseconds(1200));
+    intro.Add("If you can't afford, don't waste my smoke time.", 27, std::chrono::milliseconds(1800));
+    intro.Play();
+    Animation::Pause(std::chrono::milliseconds(500));
     UI::WaitForEnter();
 }
 
@@ -90,16 +84,16 @@ void ShopCounter::Process() {
         // Display upgrade in progress message with typewriter effect
         UI::ShowInterface("ui/Counters/Shop/shop3.txt");
         Animation::TypewriterInBox("Um, what a beautiful and powerful weapon!", 50, 24);
-        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        Animation::Pause(std::chrono::milliseconds(500));
         Animation::TypewriterInBox("It can easily destroy a whole zombie horde!", 50, 25);
-        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        Animation::Pause(std::chrono::milliseconds(500));
         UI::WaitForEnter();
 
         // Display results with typewriter effect
         UI::ShowInterface("ui/Counters/Shop/shop2.txt");
         UI::DisplayCenterText("Current level: " + std::to_string(m_player.getWeaponLevel()), 25);
         UI::DisplayCenterText("Cost: " + std::to_string(cost) + " gold", 27);
-        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        Animation::Pause(std::chrono::milliseconds(500));
     }
 
     UI::WaitForEnter("Press Enter to return to home...");
@@ -123,32 +117,21 @@ int ShopCounter::GetValidInput() {
         char yn = Terminal::GetInstance().GetYN();
         if (yn != 'y' && yn != 'Y' && yn != 'n' && yn != 'N'){
             UI::DisplayCenterText("Invalid input! Please enter y or n", 28);
-            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+            Animation::Pause(std::chrono::milliseconds(1000));
             UI::WaitForEnter("Press Enter to try again...");
             continue;
         }else if (yn == 'y' || yn == 'Y') {
             UI::DisplayCenterText("Successfully upgraded the weapon!", 28);
-            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+            Animation::Pause(std::chrono::milliseconds(1000));
             return 1;
         }else if (yn == 'n' || yn == 'N') {
             UI::DisplayCenterText("You will not upgrade the weapon.", 28);
-            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+            Animation::Pause(std::chrono::milliseconds(1000));
             return 0;
         }
     }
 }
 
-/**
- * @brief Static callback for showing weapon information
- * 
- * Called when 'W' key is pressed to display weapon stats.
- */
-void ShopCounter::ShowWeaponPowerAndLevelInfoCallback() {
-    if (currentInstance) {
-        currentInstance->ShowWeaponPowerAndLevelInfo();
-    }
-}
-
 /**
  * @brief Display weapon information and restore shop interface
  * 
@@ -166,17 +149,6 @@ void ShopCounter::ShowWeaponPowerAndLevelInfo() {
     UI::DisplayCenterText("Do you want to assign one of your workers to upgrade your weapon? [y/n] ", 27);
 }
 
-/**
- * @brief Static callback for showing player information
- * 
- * Called when 'L' key is pressed to display player stats.
- */
-void ShopCounter::ShowPlayerInfoCallback() {
-    if (currentInstance) {
-        currentInstance->ShowPlayerInfo();
-    }
-}
-
 /**
  * @brief Display player information and restore shop interface
  * 
@@ -194,17 +166,6 @@ void ShopCounter::ShowPlayerInfo() {
     UI::DisplayCenterText("Do you want to assign one of your workers to upgrade your weapon? [y/n] ", 27);
 }
 
-/**
- * @brief Static callback for showing quit message
- * 
- * Called when 'Q' key is pressed to display quit confirmation.
- */
-void ShopCounter::ShowQuitMessageCallback() {
-    if (currentInstance) {
-        currentInstance->ShowQuitMessage();
-    }
-}
-
 /**
  * @brief Display quit message and restore shop interface
  * 
@@ -225,12 +186,8 @@ void ShopCounter::ShowQuitMessage() {
 /**
  * @brief Called when exiting the shop system
  * 
- * Cleans up by removing all key callbacks.
+ * Deactivates the hot keys.
  */
 void ShopCounter::OnExit() {
-    // Clear all callbacks
-    clearHKeyCallback();
-    clearWKeyCallback();
-    clearLKeyCallback();
-    clearQKeyCallback();
+    popKeyBindings();
 }
@@ -38,26 +38,20 @@ private:
      */
     int GetValidInput();
     
-    // Pointer to the current ShopCounter instance
-    static ShopCounter* currentInstance;
-    
     /**
      * @brief Display weapon power and level information
      */
     void ShowWeaponPowerAndLevelInfo();
-    static void ShowWeaponPowerAndLevelInfoCallback();
 
     /**
      * @brief Display player's current information and resources
      */
     void ShowPlayerInfo();
-    static void ShowPlayerInfoCallback();
 
     /**
      * @brief Display quit message when player wants to exit
      */
     void ShowQuitMessage();
-    static void ShowQuitMessageCallback();
 
     // Reference to the week cycle system
     WeekCycle& m_weekCycle;
@@ -7,124 +7,251 @@
 #include "Animation.h"
 #include "Terminal.h"
 #include "UI.h"
+#include "AnimationClip.h"
+#include "InputSource.h"
+#include "ScreenLayout.h"
+#include "../Utils/Clock.h"
+#include <algorithm>
 #include <iostream>
-#include <thread>
 #include <cmath>
 #include <chrono>
-#include <fstream>
 #include <stdexcept>
-#include <dirent.h>
-#include <algorithm>
+#include <string_view>
+
+/// Speed multiplier for animations and cosmetic pauses (0 = instant)
+static double animationSpeed = 1.0;
+
+/// Longest time a wait goes without checking for the skip key
+static constexpr std::chrono::milliseconds SKIP_POLL_INTERVAL{10};
 
 /**
- * @brief Displays text with typewriter effect
+ * @brief Scales a delay by the animation speed
+ * @param delay Delay at normal speed
+ * @return Clock::Duration Delay at the current speed, zero when instant
+ */
+static Clock::Duration ScaleDelay(Clock::Duration delay) {
+    if (animationSpeed <= 0.0) {
+        return Clock::Duration::zero();
+    }
+    return Clock::Duration(static_cast<Clock::Duration::rep>(delay.count() / animationSpeed));
+}
+
+/**
+ * @brief Consumes the skip key if it is the next key waiting
  * 
- * Shows text character by character with specified delay,
- * handling cursor visibility.
- * @param text The text to animate
- * @param delayMs Delay between characters in milliseconds
+ * Any other waiting key is left for the prompt that follows.
+ * @return bool True if the skip key was pressed
  */
-void Animation::Typewriter(const std::string& text, int delayMs) {
-    Terminal::GetInstance().ShowCursor();
-    for (char c : text) {
-        std::cout << c << std::flush;
-        std::this_thread::sleep_for(std::chrono::milliseconds(delayMs));
+static bool SkipPressed() {
+    auto& input = InputSource::Get();
+    if (input.HasInput() && input.PeekChar() == Animation::SKIP_KEY) {
+        input.ReadChar();
+        return true;
     }
-    Terminal::GetInstance().HideCursor();
+    return false;
 }
 
 /**
- * @brief Displays text with typewriter effect in UI box
+ * @brief Waits until a deadline unless the skip key is pressed first
+ * @param deadline Time to wait for
+ * @return bool True if the wait was cut short by the skip key
+ */
+static bool WaitOrSkip(Clock::TimePoint deadline) {
+    auto& clock = Clock::Get();
+    while (true) {
+        if (SkipPressed()) {
+            return true;
+        }
+        auto now = clock.Now();
+        if (now >= deadline) {
+            return false;
+        }
+        clock.SleepUntil(std::min<Clock::TimePoint>(deadline, now + SKIP_POLL_INTERVAL));
+    }
+}
+
+/**
+ * @brief Sets how fast animations and cosmetic pauses run
+ * @param speed Speed multiplier: 1 is normal, 2 twice as fast, 0 instant
+ */
+void Animation::SetSpeed(double speed) {
+    animationSpeed = speed;
+}
+
+/**
+ * @brief Waits for a cosmetic delay
  * 
- * Centers and displays text with typewriter effect at specified line.
+ * Skipped entirely at instant speed; otherwise ends early when the
+ * skip key is pressed.
+ * @param delay Delay at normal speed
+ */
+void Animation::Pause(std::chrono::milliseconds delay) {
+    auto scaled = ScaleDelay(delay);
+    if (scaled > Clock::Duration::zero()) {
+        WaitOrSkip(Clock::Get().Now() + scaled);
+    }
+}
+
+/**
+ * @brief Adds a text centered on a line of the UI box
  * @param text The text to animate
- * @param delayMs Delay between characters in milliseconds
  * @param lineNumber The line number to display the text on
+ * @param startDelay Time after Play at which the first character appears
+ * @param delayMs Delay between characters in milliseconds
  */
-void Animation::TypewriterInBox(const std::string& text, int delayMs, int lineNumber) {
-    UI::MoveCursorToCenter(text, lineNumber);
-    Typewriter(text, delayMs);
+void Animation::TypewriterGroup::Add(const std::string& text, int lineNumber,
+                                     std::chrono::milliseconds startDelay, int delayMs) {
+    runs.push_back({text, lineNumber, false, startDelay, std::chrono::milliseconds(delayMs),
+                    getVisualWidth(text), 0, 0, 0, 0});
 }
 
 /**
- * @brief Compares animation frame filenames
- * 
- * Compares two animation frame filenames based on their frame numbers
- * for sorting purposes.
- * @param a First filename to compare
- * @param b Second filename to compare
- * @return bool True if a should come before b in sequence
+ * @brief Adds a text that continues at the current cursor position
+ * @param text The text to animate
+ * @param delayMs Delay between characters in milliseconds
  */
-bool Animation::CompareAnimationFiles(const std::string& a, const std::string& b) {
-    return ExtractFrameNumber(a) < ExtractFrameNumber(b);
+void Animation::TypewriterGroup::AddAtCursor(const std::string& text, int delayMs) {
+    runs.push_back({text, 0, true, std::chrono::milliseconds(0), std::chrono::milliseconds(delayMs),
+                    getVisualWidth(text), 0, 0, 0, 0});
 }
 
 /**
- * @brief Extracts frame number from filename
+ * @brief Reveals every text and returns once all are fully shown
  * 
- * Parses the numeric frame number from an animation frame filename.
- * @param filename The animation frame filename
- * @return int The extracted frame number
- * @throw std::runtime_error if filename format is invalid
+ * Character i of a text is due at its start delay plus i character
+ * delays, all measured from the start of Play, so output time does not
+ * add up. Each frame appends the newly due characters of every text to
+ * the terminal buffer (with a cursor move only when switching texts)
+ * and flushes once, then sleeps until the next character is due but no
+ * less than FRAME_INTERVAL. Multi-byte UTF-8 characters are never split
+ * across frames.
  */
-int Animation::ExtractFrameNumber(const std::string& filename) {
-    size_t dotPos = filename.find_last_of('.');
-    if (dotPos == std::string::npos || filename.substr(dotPos) != ".txt") {
-        throw std::runtime_error("Invalid animation frame format: " + filename);
+void Animation::TypewriterGroup::Play() {
+    auto& terminal = Terminal::GetInstance();
+    auto& clock = Clock::Get();
+    for (auto& run : runs) {
+        if (!run.atCursor) {
+            auto position = UI::GetCenterPosition(run.text, run.lineNumber);
+            run.x = position.x;
+            run.y = position.y;
+        }
     }
-    
-    try {
-        return std::stoi(filename.substr(0, dotPos));
-    } catch (...) {
-        throw std::runtime_error("Failed to parse frame number: " + filename);
+
+    terminal.ShowCursor();
+    auto start = clock.Now();
+    bool revealAll = false;
+    const Run* cursorRun = nullptr;  // Run whose last character the cursor follows
+    while (true) {
+        auto now = clock.Now();
+        auto elapsed = now - start;
+        auto nextDue = Clock::TimePoint::max();
+        for (auto& run : runs) {
+            auto runStart = ScaleDelay(run.startDelay);
+            auto charDelay = ScaleDelay(run.charDelay);
+            size_t due = run.charCount;
+            if (!revealAll) {
+                if (elapsed < runStart) {
+                    due = 0;
+                } else if (charDelay > Clock::Duration::zero()) {
+                    due = std::min<size_t>(run.charCount, (elapsed - runStart) / charDelay + 1);
+                }
+            }
+
+            if (due > run.shownChars) {
+                size_t begin = run.shownBytes;
+                if (!run.atCursor && cursorRun != &run) {
+                    terminal.AppendCursorMove(run.x + static_cast<int>(run.shownChars), run.y);
+                }
+                while (run.shownChars < due) {
+                    run.shownBytes = nextCharacterOffset(run.text, run.shownBytes);
+                    run.shownChars++;
+                }
+                terminal.AppendText(std::string_view(run.text).substr(begin, run.shownBytes - begin));
+                cursorRun = &run;
+            }
+
+            if (run.shownChars < run.charCount) {
+                nextDue = std::min(nextDue, start + runStart + charDelay * static_cast<Clock::Duration::rep>(run.shownChars));
+            }
+        }
+        terminal.Flush();
+
+        if (nextDue == Clock::TimePoint::max()) {
+            break;
+        }
+        if (WaitOrSkip(std::max<Clock::TimePoint>(nextDue, now + FRAME_INTERVAL))) {
+            revealAll = true;
+        }
     }
+    terminal.HideCursor();
 }
 
 /**
- * @brief Gets sorted list of animation frame files
+ * @brief Displays text with typewriter effect
  * 
- * Retrieves and sorts animation frame files from a directory
- * based on their frame numbers.
- * @param dirPath Path to the directory containing animation frames
- * @return std::vector<std::string> containing sorted frame filenames
- * @throw std::runtime_error if directory cannot be opened
+ * Reveals the text at the cursor position with the delay scaled by the
+ * animation speed, writing the characters due in each frame together.
+ * The skip key prints the remaining text at once.
+ * @param text The text to animate
+ * @param delayMs Delay between characters in milliseconds
  */
-std::vector<std::string> Animation::GetSortedFrames(const std::string& dirPath) {
-    std::vector<std::string> frames;
-    DIR* dir = opendir(dirPath.c_str());
-    if (!dir) {
-        throw std::runtime_error("Cannot open animation directory: " + dirPath);
-    }
+void Animation::Typewriter(const std::string& text, int delayMs) {
+    TypewriterGroup group;
+    group.AddAtCursor(text, delayMs);
+    group.Play();
+}
 
-    struct dirent* entry;
-    while ((entry = readdir(dir)) != nullptr) {
-        std::string filename(entry->d_name);
-        if (filename[0] != '.' && filename.find(".txt") != std::string::npos) {
-            frames.push_back(filename);
-        }
-    }
-    closedir(dir);
-    
-    std::sort(frames.begin(), frames.end(), CompareAnimationFiles);
-    return frames;
+/**
+ * @brief Displays text with typewriter effect in UI box
+ * 
+ * Centers and displays text with typewriter effect at specified line.
+ * @param text The text to animate
+ * @param delayMs Delay between characters in milliseconds
+ * @param lineNumber The line number to display the text on
+ */
+void Animation::TypewriterInBox(const std::string& text, int delayMs, int lineNumber) {
+    TypewriterGroup group;
+    group.Add(text, lineNumber, std::chrono::milliseconds(0), delayMs);
+    group.Play();
 }
 
 /**
  * @brief Plays a sequence of animation frames
  * 
- * Loads and displays a sequence of animation frames with specified delay.
+ * Takes the pre-rendered frames of the directory's clip and writes each
+ * one with a single buffered write. Deadlines are measured from the
+ * start of playback, so time spent writing a frame is taken out of the
+ * following sleep instead of accumulating as drift. At instant speed
+ * only the last frame is drawn, and the skip key jumps to it.
  * @param dirPath Path to the directory containing animation frames
  * @param frameDelayMs Delay between frames in milliseconds
  * @throw std::runtime_error if no frames are found
  */
 void Animation::PlaySequence(const std::string& dirPath, int frameDelayMs) {
-    auto frames = GetSortedFrames(dirPath);
-    if (frames.empty()) {
-        throw std::runtime_error("No animation frames found in: " + dirPath);
+    auto& terminal = Terminal::GetInstance();
+    auto size = terminal.GetTerminalSize();
+    auto& clip = AnimationClip::Get(dirPath);
+    const auto& frames = clip.Render(size.width, size.height);
+
+    auto frameDelay = ScaleDelay(std::chrono::milliseconds(frameDelayMs));
+    if (frameDelay == Clock::Duration::zero()) {
+        terminal.AppendText(clip.RenderLastFrame(size.width, size.height));
+        terminal.Flush();
+        return;
     }
 
-    for (const auto& frameFile : frames) {
-        UI::ShowInterface(dirPath + "/" + frameFile);
-        std::this_thread::sleep_for(std::chrono::milliseconds(frameDelayMs));
+    auto deadline = Clock::Get().Now();
+    for (size_t i = 0; i < frames.size(); i++) {
+        terminal.AppendText(frames[i]);
+        terminal.Flush();
+        deadline += frameDelay;
+        if (WaitOrSkip(deadline)) {
+            // Skipped: jump straight to the final frame
+            if (i + 1 < frames.size()) {
+                terminal.AppendText(clip.RenderLastFrame(size.width, size.height));
+                terminal.Flush();
+            }
+            break;
+        }
     }
 }
@@ -3,15 +3,20 @@
  * @brief Animation management class for handling text and sequence animations
  * 
  * This file defines the Animation class, which provides functionality for:
- * - Text-based animations (typewriter effect)
+ * - Text-based animations (typewriter effect), alone or as a group of
+ *   lines revealed together on a shared frame clock
  * - Frame-based sequence animations
  * - Animation frame management and sequencing
+ * - Cosmetic pauses between animations
  * 
  * The Animation class supports both simple text animations and complex
  * multi-frame sequence animations, with configurable timing and positioning.
+ * All of these honor a global speed setting, and pressing the skip key
+ * (space) finishes the animation or pause in progress at once.
  * 
  * @see UI
  * @see Terminal
+ * @see AnimationClip
  */
 
 #pragma once
@@ -22,11 +27,105 @@
 
 class Animation {
 public:
+    /// Key that finishes the current animation or pause immediately
+    static constexpr int SKIP_KEY = ' ';
+
+    /// Slowest non-zero speed; slower ones would overflow the scaled delays
+    static constexpr double MIN_SPEED = 0.01;
+
+    /// Shortest time between two writes of a typewriter group
+    static constexpr std::chrono::milliseconds FRAME_INTERVAL{16};
+
+    /**
+     * @class TypewriterGroup
+     * @brief Typewriter texts revealed together on one frame clock
+     * 
+     * Each text has its own start delay and character delay, both
+     * measured from the moment Play is called, so several lines can
+     * type at once. Every frame writes the characters revealed since
+     * the previous frame, for all texts, in a single buffered write;
+     * frames are at least FRAME_INTERVAL apart. Pressing the skip key
+     * reveals the whole group at once.
+     */
+    class TypewriterGroup {
+    public:
+        /**
+         * @brief Adds a text centered on a line of the UI box
+         * @param text The text to animate
+         * @param lineNumber The line number to display the text on
+         * @param startDelay Time after Play at which the first character appears
+         * @param delayMs Delay between characters in milliseconds
+         * @return void
+         */
+        void Add(const std::string& text, int lineNumber,
+                 std::chrono::milliseconds startDelay = std::chrono::milliseconds(0),
+                 int delayMs = 50);
+
+        /**
+         * @brief Adds a text that continues at the current cursor position
+         * 
+         * The text is written without cursor moves, so it must be the
+         * only text in the group.
+         * @param text The text to animate
+         * @param delayMs Delay between characters in milliseconds
+         * @return void
+         */
+        void AddAtCursor(const std::string& text, int delayMs = 50);
+
+        /**
+         * @brief Reveals every text and returns once all are fully shown
+         * 
+         * Start and character delays are scaled by the animation speed;
+         * at instant speed everything is written in one frame.
+         * @return void
+         */
+        void Play();
+
+    private:
+        /**
+         * @brief One text of the group and how much of it is shown
+         */
+        struct Run {
+            std::string text;                      ///< Text to reveal
+            int lineNumber;                        ///< Box line to center on, unused at the cursor
+            bool atCursor;                         ///< Written where the cursor already is
+            std::chrono::milliseconds startDelay;  ///< Delay before the first character
+            std::chrono::milliseconds charDelay;   ///< Delay between characters
+            size_t charCount;                      ///< Characters in the text, UTF-8 aware
+            size_t shownChars;                     ///< Characters written so far
+            size_t shownBytes;                     ///< Bytes of text written so far
+            int x;                                 ///< Terminal column of the first character
+            int y;                                 ///< Terminal row of the text
+        };
+
+        std::vector<Run> runs;  ///< Texts in the order they were added
+    };
+
+    /**
+     * @brief Sets how fast animations and cosmetic pauses run
+     * @param speed Speed multiplier: 1 is normal, 2 twice as fast, 0 instant;
+     *        otherwise at least MIN_SPEED
+     * @return void
+     */
+    static void SetSpeed(double speed);
+
+    /**
+     * @brief Waits for a cosmetic delay
+     * 
+     * The delay is divided by the animation speed and ends early when
+     * the skip key is pressed. Use the Clock directly for delays that
+     * affect gameplay.
+     * @param delay Delay at normal speed
+     * @return void
+     */
+    static void Pause(std::chrono::milliseconds delay);
+
     /**
      * @brief Displays text with a typewriter effect
      * 
      * Displays text character by character with a specified delay
-     * between characters.
+     * between characters, as a one-text TypewriterGroup. Pressing the
+     * skip key prints the rest at once.
      * @param text The text to animate
      * @param delayMs Delay between characters in milliseconds
      * @return void
@@ -48,41 +147,13 @@ public:
     /**
      * @brief Plays a sequence of animation frames
      * 
-     * Loads and displays a sequence of animation frames from a directory,
-     * with a specified delay between frames.
+     * Plays the preloaded clip of a directory on a fixed schedule: frame i
+     * is shown at start + i * frameDelayMs, so render time does not add
+     * to the nominal frame delay. Pressing the skip key jumps to the
+     * last frame.
      * @param dirPath Path to the directory containing animation frames
      * @param frameDelayMs Delay between frames in milliseconds
      * @return void
      */
     static void PlaySequence(const std::string& dirPath, int frameDelayMs);
-
-private:
-    /**
-     * @brief Gets sorted list of animation frame files
-     * 
-     * Retrieves and sorts animation frame files from a directory
-     * based on their frame numbers.
-     * @param dirPath Path to the directory containing animation frames
-     * @return std::vector<std::string> containing sorted frame filenames
-     */
-    static std::vector<std::string> GetSortedFrames(const std::string& dirPath);
-    
-    /**
-     * @brief Extracts frame number from filename
-     * 
-     * Parses the frame number from an animation frame filename.
-     * @param filename The animation frame filename
-     * @return int The extracted frame number
-     */
-    static int ExtractFrameNumber(const std::string& filename);
-
-    /**
-     * @brief Compares animation frame filenames
-     * 
-     * Compares two animation frame filenames based on their frame numbers.
-     * @param a First filename to compare
-     * @param b Second filename to compare
-     * @return bool True if a should come before b in sequence
-     */
-    static bool CompareAnimationFiles(const std::string& a, const std::string& b);
 };
\ No newline at end of file
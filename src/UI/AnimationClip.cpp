@@ -0,0 +1,267 @@
+/**
+ * @file AnimationClip.cpp
+ * @brief Implementation of preloaded animation clips
+ * @details Discovers, orders and pre-renders the frames of an animation
+ *          directory so playback is a plain buffered write per frame.
+ */
+#include "AnimationClip.h"
+#include "AssetCache.h"
+#include "ChangeRun.h"
+#include "Terminal.h"
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <unordered_map>
+
+/// Source of blank text for spans that erase characters
+static const std::string BLANKS(256, ' ');
+
+/**
+ * @brief Finds the byte offset of every character in a UTF-8 line
+ * 
+ * Steps with nextCharacterOffset like getVisualWidth, so entry i is the
+ * start of visual column i. A final entry holds the line length.
+ * @param line The line to scan
+ * @return std::vector<size_t> Character start offsets plus the end offset
+ */
+static std::vector<size_t> CharacterOffsets(std::string_view line) {
+    std::vector<size_t> offsets;
+    for (size_t i = 0; i < line.length(); i = nextCharacterOffset(line, i)) {
+        if ((line[i] & 0xC0) != 0x80) {  // Same columns as getVisualWidth
+            offsets.push_back(i);
+        }
+    }
+    offsets.push_back(line.length());
+    return offsets;
+}
+
+/**
+ * @brief Gets a run of blanks as a view
+ * @param count Number of blanks
+ * @return std::string_view The blanks, at most BLANKS.size() long
+ */
+static std::string_view Blanks(size_t count) {
+    return std::string_view(BLANKS).substr(0, count);
+}
+
+/**
+ * @brief Gets the clip for an animation directory
+ * @param dirPath Path to the directory containing animation frames
+ * @return AnimationClip& The loaded clip
+ */
+AnimationClip& AnimationClip::Get(const std::string& dirPath) {
+    static std::unordered_map<std::string, std::unique_ptr<AnimationClip>> clips;
+
+    auto it = clips.find(dirPath);
+    if (it == clips.end()) {
+        it = clips.emplace(dirPath, std::make_unique<AnimationClip>(dirPath)).first;
+    }
+    return *it->second;
+}
+
+/**
+ * @brief Loads all frames of an animation directory
+ * 
+ * Orders the frame files by number and takes their layouts from the
+ * asset cache, which reads each file at most once.
+ * @param dirPath Path to the directory containing animation frames
+ * @throw std::runtime_error if no frames are found
+ */
+AnimationClip::AnimationClip(const std::string& dirPath) {
+    auto files = GetSortedFrames(dirPath);
+    if (files.empty()) {
+        throw std::runtime_error("No animation frames found in: " + dirPath);
+    }
+
+    auto& cache = AssetCache::GetInstance();
+    const ScreenLayout* previous = nullptr;
+    for (const auto& file : files) {
+        const ScreenLayout* layout = &cache.GetLayout(dirPath + "/" + file);
+
+        // A frame with different dimensions is centered differently,
+        // so it cannot be expressed as changes to the previous one
+        bool keyframe = previous == nullptr ||
+                        previous->GetBoxWidth() != layout->GetBoxWidth() ||
+                        previous->GetLineCount() != layout->GetLineCount();
+
+        frames.push_back({layout, keyframe, keyframe ? std::vector<Span>() : Diff(*previous, *layout)});
+        previous = layout;
+    }
+}
+
+/**
+ * @brief Computes the changed spans between two frames
+ * 
+ * Walks each pair of lines one character (visual column) at a time and
+ * groups differing columns into spans, merging spans whose gap is short.
+ * When the new line is shorter, its missing tail is blanked.
+ * @param previous Layout of the preceding frame
+ * @param current Layout of the frame to encode
+ * @return std::vector<Span> The spans that turn previous into current
+ */
+std::vector<AnimationClip::Span> AnimationClip::Diff(const ScreenLayout& previous, const ScreenLayout& current) {
+    std::vector<Span> spans;
+
+    for (size_t row = 0; row < current.GetLineCount(); row++) {
+        std::string_view newLine = current.GetLine(row);
+        std::string_view oldLine = row < previous.GetLineCount() ? previous.GetLine(row) : std::string_view();
+        auto newOffsets = CharacterOffsets(newLine);
+        auto oldOffsets = CharacterOffsets(oldLine);
+        int newWidth = static_cast<int>(newOffsets.size()) - 1;
+        int oldWidth = static_cast<int>(oldOffsets.size()) - 1;
+
+        auto character = [](std::string_view line, const std::vector<size_t>& offsets, int column) {
+            return line.substr(offsets[column], offsets[column + 1] - offsets[column]);
+        };
+
+        int column = 0;
+        while (column < newWidth) {
+            if (column < oldWidth &&
+                character(newLine, newOffsets, column) == character(oldLine, oldOffsets, column)) {
+                column++;
+                continue;
+            }
+
+            int spanStart = column;
+            int spanEnd = ExtendChangeRun([&](int i) {
+                return i >= oldWidth || character(newLine, newOffsets, i) != character(oldLine, oldOffsets, i);
+            }, spanStart, newWidth, MAX_GAP);
+
+            spans.push_back({static_cast<int>(row), spanStart,
+                             newLine.substr(newOffsets[spanStart], newOffsets[spanEnd] - newOffsets[spanStart])});
+            column = spanEnd;
+        }
+
+        // Erase whatever the previous frame had beyond the end of this line
+        for (int blankStart = newWidth; blankStart < oldWidth; blankStart += static_cast<int>(BLANKS.size())) {
+            spans.push_back({static_cast<int>(row), blankStart,
+                             Blanks(static_cast<size_t>(oldWidth - blankStart))});
+        }
+    }
+
+    return spans;
+}
+
+/**
+ * @brief Gets the frames rendered for a terminal size
+ * 
+ * Renders keyframes as a screen clear followed by all lines at their
+ * centered positions, the same output UI::ShowInterface produces, and
+ * other frames as one cursor move plus text per changed span. Every
+ * frame ends with the cursor on the last terminal row.
+ * @param terminalWidth Terminal width in columns
+ * @param terminalHeight Terminal height in rows
+ * @return const std::vector<std::string>& Output bytes of every frame
+ */
+const std::vector<std::string>& AnimationClip::Render(int terminalWidth, int terminalHeight) {
+    if (terminalWidth == renderedWidth && terminalHeight == renderedHeight) {
+        return rendered;
+    }
+
+    rendered.clear();
+    rendered.reserve(frames.size());
+    for (const auto& frame : frames) {
+        auto placement = frame.layout->Center(terminalWidth, terminalHeight);
+
+        std::string output;
+        if (frame.keyframe) {
+            output = RenderFull(*frame.layout, terminalWidth, terminalHeight);
+        } else {
+            for (const auto& span : frame.spans) {
+                Terminal::FormatCursorMove(output, placement.left + span.column, placement.top + span.row);
+                output.append(span.text);
+            }
+            Terminal::FormatCursorMove(output, 1, terminalHeight);
+        }
+        rendered.push_back(std::move(output));
+    }
+
+    renderedWidth = terminalWidth;
+    renderedHeight = terminalHeight;
+    return rendered;
+}
+
+/**
+ * @brief Renders the last frame in full
+ * 
+ * Used to jump to the end of a clip without replaying the changes that
+ * lead up to it.
+ * @param terminalWidth Terminal width in columns
+ * @param terminalHeight Terminal height in rows
+ * @return std::string Output bytes that clear the screen and draw the frame
+ */
+std::string AnimationClip::RenderLastFrame(int terminalWidth, int terminalHeight) const {
+    return RenderFull(*frames.back().layout, terminalWidth, terminalHeight);
+}
+
+/**
+ * @brief Renders a layout as a screen clear followed by all its lines
+ * 
+ * Produces the same output as UI::ShowInterface, ending with the cursor
+ * on the last terminal row.
+ * @param layout Layout to draw
+ * @param terminalWidth Terminal width in columns
+ * @param terminalHeight Terminal height in rows
+ * @return std::string Output bytes of the frame
+ */
+std::string AnimationClip::RenderFull(const ScreenLayout& layout, int terminalWidth, int terminalHeight) {
+    auto placement = layout.Center(terminalWidth, terminalHeight);
+
+    std::string output = "\033[2J\033[1;1H";
+    for (size_t i = 0; i < layout.GetLineCount(); i++) {
+        Terminal::FormatCursorMove(output, placement.left, placement.top + static_cast<int>(i));
+        output.append(layout.GetLine(i));
+    }
+    Terminal::FormatCursorMove(output, 1, terminalHeight);
+    return output;
+}
+
+/**
+ * @brief Compares animation frame filenames
+ * 
+ * Compares two animation frame filenames based on their frame numbers
+ * for sorting purposes.
+ * @param a First filename to compare
+ * @param b Second filename to compare
+ * @return bool True if a should come before b in sequence
+ */
+bool AnimationClip::CompareAnimationFiles(const std::string& a, const std::string& b) {
+    return ExtractFrameNumber(a) < ExtractFrameNumber(b);
+}
+
+/**
+ * @brief Extracts frame number from filename
+ * 
+ * Parses the numeric frame number from an animation frame filename.
+ * @param filename The animation frame filename
+ * @return int The extracted frame number
+ * @throw std::runtime_error if filename format is invalid
+ */
+int AnimationClip::ExtractFrameNumber(const std::string& filename) {
+    size_t dotPos = filename.find_last_of('.');
+    if (dotPos == std::string::npos || filename.substr(dotPos) != ".txt") {
+        throw std::runtime_error("Invalid animation frame format: " + filename);
+    }
+    
+    try {
+        return std::stoi(filename.substr(0, dotPos));
+    } catch (...) {
+        throw std::runtime_error("Failed to parse frame number: " + filename);
+    }
+}
+
+/**
+ * @brief Gets sorted list of animation frame files
+ * 
+ * Retrieves the frame files of a directory from the asset cache, which
+ * reads the bundle index or the directory on disk, and sorts them by
+ * frame number.
+ * @param dirPath Path to the directory containing animation frames
+ * @return std::vector<std::string> containing sorted frame filenames
+ * @throw std::runtime_error if directory cannot be opened
+ */
+std::vector<std::string> AnimationClip::GetSortedFrames(const std::string& dirPath) {
+    std::vector<std::string> frames = AssetCache::GetInstance().List(dirPath);
+    std::sort(frames.begin(), frames.end(), CompareAnimationFiles);
+    return frames;
+}
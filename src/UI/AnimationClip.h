@@ -0,0 +1,142 @@
+/**
+ * @file AnimationClip.h
+ * @brief Preloaded, pre-rendered frame sequence for an animation directory
+ * 
+ * This file defines the AnimationClip class, which loads the numbered
+ * frame files of an animation directory once and keeps them ready to play:
+ * - Frame discovery and numeric ordering happen on first use only
+ * - Frame text comes from the AssetCache as pre-measured layouts
+ * - Every frame after the first is stored as the spans of text that
+ *   changed relative to the previous frame, so playback only sends those
+ * - Each frame is rendered once per terminal size into the exact bytes
+ *   sent to the terminal, already centered
+ * 
+ * @see Animation
+ * @see AssetCache
+ * @see ScreenLayout
+ */
+
+#pragma once
+#include "ScreenLayout.h"
+#include <string>
+#include <string_view>
+#include <vector>
+
+class AnimationClip {
+public:
+    /**
+     * @brief Gets the clip for an animation directory
+     * 
+     * Loads the clip the first time a directory is requested and
+     * returns the same instance afterwards.
+     * @param dirPath Path to the directory containing animation frames
+     * @return AnimationClip& The loaded clip
+     * @throw std::runtime_error if the directory cannot be opened or is empty
+     */
+    static AnimationClip& Get(const std::string& dirPath);
+
+    /**
+     * @brief Loads all frames of an animation directory
+     * @param dirPath Path to the directory containing animation frames
+     * @throw std::runtime_error if the directory cannot be opened or is empty
+     */
+    explicit AnimationClip(const std::string& dirPath);
+
+    /**
+     * @brief Gets the frames rendered for a terminal size
+     * 
+     * The first entry clears the screen and draws the whole first frame;
+     * later entries only redraw what changed since the entry before, so
+     * they must be played in order. The result is cached and only
+     * rebuilt when the terminal size changes.
+     * @param terminalWidth Terminal width in columns
+     * @param terminalHeight Terminal height in rows
+     * @return const std::vector<std::string>& Output bytes of every frame
+     */
+    const std::vector<std::string>& Render(int terminalWidth, int terminalHeight);
+
+    /**
+     * @brief Renders the last frame in full, for skipping to the end
+     * @param terminalWidth Terminal width in columns
+     * @param terminalHeight Terminal height in rows
+     * @return std::string Output bytes that clear the screen and draw the frame
+     */
+    std::string RenderLastFrame(int terminalWidth, int terminalHeight) const;
+
+private:
+    /**
+     * @brief A run of changed text within one line of a frame
+     */
+    struct Span {
+        int row;                ///< Line index within the frame
+        int column;             ///< Visual column of the first character
+        std::string_view text;  ///< Replacement text, viewed in cached storage
+    };
+
+    /**
+     * @brief One frame, either drawn in full or as changes to its predecessor
+     */
+    struct Frame {
+        const ScreenLayout* layout;  ///< Full layout of the frame
+        bool keyframe;               ///< True if the frame is drawn in full
+        std::vector<Span> spans;     ///< Changed runs, unused for keyframes
+    };
+
+    /// Gaps of at most this many unchanged characters between two changes
+    /// are resent rather than skipped, as a cursor move costs more bytes
+    static constexpr int MAX_GAP = 6;
+
+    std::vector<Frame> frames;                ///< Frames, in play order
+    std::vector<std::string> rendered;        ///< Output bytes for the cached size
+    int renderedWidth = -1;                   ///< Terminal width of the cached render
+    int renderedHeight = -1;                  ///< Terminal height of the cached render
+
+    /**
+     * @brief Renders a layout as a screen clear followed by all its lines
+     * @param layout Layout to draw
+     * @param terminalWidth Terminal width in columns
+     * @param terminalHeight Terminal height in rows
+     * @return std::string Output bytes of the frame
+     */
+    static std::string RenderFull(const ScreenLayout& layout, int terminalWidth, int terminalHeight);
+
+    /**
+     * @brief Computes the changed spans between two frames
+     * 
+     * Compares the frames line by line and character by character. Text
+     * that disappears is overwritten with blanks.
+     * @param previous Layout of the preceding frame
+     * @param current Layout of the frame to encode
+     * @return std::vector<Span> The spans that turn previous into current
+     */
+    static std::vector<Span> Diff(const ScreenLayout& previous, const ScreenLayout& current);
+
+    /**
+     * @brief Gets sorted list of animation frame files
+     * 
+     * Retrieves and sorts animation frame files from a directory
+     * based on their frame numbers.
+     * @param dirPath Path to the directory containing animation frames
+     * @return std::vector<std::string> containing sorted frame filenames
+     */
+    static std::vector<std::string> GetSortedFrames(const std::string& dirPath);
+    
+    /**
+     * @brief Extracts frame number from filename
+     * 
+     * Parses the frame number from an animation frame filename.
+     * @param filename The animation frame filename
+     * @return int The extracted frame number
+     */
+    static int ExtractFrameNumber(const std::string& filename);
+
+    /**
+     * @brief Compares animation frame filenames
+     * 
+     * Compares two animation frame filenames based on their frame numbers.
+     * @param a First filename to compare
+     * @param b Second filename to compare
+     * @return bool True if a should come before b in sequence
+     */
+    static bool CompareAnimationFiles(const std::string& a, const std::string& b);
+};
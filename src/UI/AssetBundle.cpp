@@ -0,0 +1,174 @@
+/**
+ * @file AssetBundle.cpp
+ * @brief Implementation of the memory-mapped asset bundle
+ * @details Maps a packed asset file read-only and serves lookups and
+ *          directory listings from its sorted index without copying.
+ */
+#include "AssetBundle.h"
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using AssetBundleFormat::Entry;
+using AssetBundleFormat::Header;
+
+/**
+ * @brief Destructor
+ * 
+ * Releases the mapping if a bundle was opened.
+ */
+AssetBundle::~AssetBundle() {
+    if (base) {
+        munmap(const_cast<char*>(base), size);
+    }
+}
+
+/**
+ * @brief Maps a bundle file into memory
+ * 
+ * Checks the magic number, version and that every index entry points
+ * inside the file before accepting the bundle.
+ * @param path Path to the bundle file
+ * @return bool True if the bundle was opened
+ */
+bool AssetBundle::Open(const std::string& path) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(Header)) {
+        close(fd);
+        return false;
+    }
+
+    size_t length = static_cast<size_t>(info.st_size);
+    void* mapping = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        return false;
+    }
+
+    const char* data = static_cast<const char*>(mapping);
+    const Header* header = reinterpret_cast<const Header*>(data);
+    bool valid = std::memcmp(header->magic, AssetBundleFormat::MAGIC, sizeof(header->magic)) == 0 &&
+                 header->version == AssetBundleFormat::VERSION &&
+                 header->count <= (length - sizeof(Header)) / sizeof(Entry);
+
+    const Entry* index = reinterpret_cast<const Entry*>(data + sizeof(Header));
+    for (uint32_t i = 0; valid && i < header->count; i++) {
+        valid = index[i].pathOffset <= length && index[i].pathLength <= length - index[i].pathOffset &&
+                index[i].dataOffset <= length && index[i].dataLength <= length - index[i].dataOffset;
+    }
+
+    if (!valid) {
+        munmap(mapping, length);
+        return false;
+    }
+
+    if (base) {
+        munmap(const_cast<char*>(base), size);
+    }
+    base = data;
+    size = length;
+    entries = index;
+    count = header->count;
+    return true;
+}
+
+/**
+ * @brief Checks whether a bundle is mapped
+ * @return bool True if open
+ */
+bool AssetBundle::IsOpen() const {
+    return base != nullptr;
+}
+
+/**
+ * @brief Looks up a packed file
+ * @param path Path of the file as it was packed
+ * @param contents Set to a view of the file contents if found
+ * @return bool True if the file is in the bundle
+ */
+bool AssetBundle::Find(std::string_view path, std::string_view& contents) const {
+    uint32_t i = LowerBound(path);
+    if (i == count || PathOf(entries[i]) != path) {
+        return false;
+    }
+    contents = std::string_view(base + entries[i].dataOffset, entries[i].dataLength);
+    return true;
+}
+
+/**
+ * @brief Lists the files directly inside a packed directory
+ * 
+ * Entries below the directory are contiguous in the sorted index, so
+ * only that range is scanned. Files in subdirectories are skipped.
+ * @param dirPath Directory path without trailing slash
+ * @return std::vector<std::string> File names, without the directory part
+ */
+std::vector<std::string> AssetBundle::List(std::string_view dirPath) const {
+    std::vector<std::string> names;
+    std::string prefix = std::string(dirPath) + "/";
+
+    for (uint32_t i = LowerBound(prefix); i < count; i++) {
+        std::string_view entryPath = PathOf(entries[i]);
+        if (entryPath.compare(0, prefix.size(), prefix) != 0) {
+            break;
+        }
+        std::string_view name = entryPath.substr(prefix.size());
+        if (name.find('/') == std::string_view::npos) {
+            names.emplace_back(name);
+        }
+    }
+    return names;
+}
+
+/**
+ * @brief Counts the files anywhere below a packed directory
+ * @param dirPath Directory path without trailing slash
+ * @return size_t Number of files
+ */
+size_t AssetBundle::CountBelow(std::string_view dirPath) const {
+    std::string prefix = std::string(dirPath) + "/";
+
+    size_t found = 0;
+    for (uint32_t i = LowerBound(prefix); i < count; i++) {
+        if (PathOf(entries[i]).compare(0, prefix.size(), prefix) != 0) {
+            break;
+        }
+        found++;
+    }
+    return found;
+}
+
+/**
+ * @brief Gets the path of an index entry
+ * @param entry The entry
+ * @return std::string_view The packed path
+ */
+std::string_view AssetBundle::PathOf(const Entry& entry) const {
+    return std::string_view(base + entry.pathOffset, entry.pathLength);
+}
+
+/**
+ * @brief Finds the first entry whose path is not less than a key
+ * @param key Path to search for
+ * @return uint32_t Index of the entry, or count if none
+ */
+uint32_t AssetBundle::LowerBound(std::string_view key) const {
+    uint32_t low = 0;
+    uint32_t high = count;
+    while (low < high) {
+        uint32_t mid = low + (high - low) / 2;
+        if (PathOf(entries[mid]) < key) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
@@ -0,0 +1,131 @@
+/**
+ * @file AssetBundle.h
+ * @brief Read-only, memory-mapped bundle of packed game assets
+ * 
+ * This file defines the on-disk format shared by the asset packer tool
+ * and the game, and the AssetBundle class that reads it. A bundle is a
+ * single file holding every text asset under ui/ and anim/:
+ * - A fixed header identifying the format
+ * - An index of entries sorted by path, searched with binary search
+ * - The path strings and file contents, referenced by offset
+ * 
+ * The game maps the bundle into memory and hands out views straight into
+ * the mapping, so assets are never copied or parsed at load time.
+ * 
+ * @see AssetCache
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace AssetBundleFormat {
+    /// Identifies an asset bundle file
+    constexpr char MAGIC[4] = {'C', 'T', 'A', 'B'};
+    /// Format revision, bumped on incompatible layout changes
+    constexpr uint32_t VERSION = 1;
+    /// Default file name of the bundle next to the game binary
+    constexpr const char* FILE_NAME = "assets.pak";
+
+    /**
+     * @brief Bundle file header, at offset 0
+     */
+    struct Header {
+        char magic[4];       ///< Always MAGIC
+        uint32_t version;    ///< Always VERSION
+        uint32_t count;      ///< Number of entries in the index
+        uint32_t reserved;   ///< Zero
+    };
+
+    /**
+     * @brief Index entry describing one packed file
+     * 
+     * Entries directly follow the header and are sorted by path.
+     * All offsets are relative to the start of the file.
+     */
+    struct Entry {
+        uint32_t pathOffset;  ///< Offset of the path string (not terminated)
+        uint32_t pathLength;  ///< Length of the path in bytes
+        uint32_t dataOffset;  ///< Offset of the file contents
+        uint32_t dataLength;  ///< Length of the file contents in bytes
+    };
+}
+
+class AssetBundle {
+public:
+    /**
+     * @brief Constructs a closed bundle
+     */
+    AssetBundle() = default;
+
+    /**
+     * @brief Destructor
+     * Unmaps the bundle if open
+     */
+    ~AssetBundle();
+
+    /// Deleted copy constructor and assignment operator
+    AssetBundle(const AssetBundle&) = delete;
+    AssetBundle& operator=(const AssetBundle&) = delete;
+
+    /**
+     * @brief Maps a bundle file into memory
+     * 
+     * The header and index are validated; a missing or malformed file
+     * leaves the bundle closed.
+     * @param path Path to the bundle file
+     * @return bool True if the bundle was opened
+     */
+    bool Open(const std::string& path);
+
+    /**
+     * @brief Checks whether a bundle is mapped
+     * @return bool True if open
+     */
+    bool IsOpen() const;
+
+    /**
+     * @brief Looks up a packed file
+     * @param path Path of the file as it was packed (e.g. "ui/empty.txt")
+     * @param contents Set to a view of the file contents if found
+     * @return bool True if the file is in the bundle
+     */
+    bool Find(std::string_view path, std::string_view& contents) const;
+
+    /**
+     * @brief Lists the files directly inside a packed directory
+     * @param dirPath Directory path without trailing slash (e.g. "anim/Title")
+     * @return std::vector<std::string> File names, without the directory part
+     */
+    std::vector<std::string> List(std::string_view dirPath) const;
+
+    /**
+     * @brief Counts the files anywhere below a packed directory
+     * @param dirPath Directory path without trailing slash
+     * @return size_t Number of files
+     */
+    size_t CountBelow(std::string_view dirPath) const;
+
+private:
+    const char* base = nullptr;                                ///< Start of the mapping
+    size_t size = 0;                                           ///< Length of the mapping
+    const AssetBundleFormat::Entry* entries = nullptr;         ///< Index, sorted by path
+    uint32_t count = 0;                                        ///< Number of index entries
+
+    /**
+     * @brief Gets the path of an index entry
+     * @param entry The entry
+     * @return std::string_view The packed path
+     */
+    std::string_view PathOf(const AssetBundleFormat::Entry& entry) const;
+
+    /**
+     * @brief Finds the first entry whose path is not less than a key
+     * @param key Path to search for
+     * @return uint32_t Index of the entry, or count if none
+     */
+    uint32_t LowerBound(std::string_view key) const;
+};
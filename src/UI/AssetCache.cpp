@@ -0,0 +1,201 @@
+/**
+ * @file AssetCache.cpp
+ * @brief Implementation of the in-memory asset cache
+ * @details Loads UI and animation text files once and serves them
+ *          from memory for the rest of the game.
+ */
+#include "AssetCache.h"
+#include "EmbeddedAssets.h"
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/// Static member initialization
+std::unique_ptr<AssetCache> AssetCache::instance = nullptr;
+std::mutex AssetCache::mutex;
+
+/**
+ * @brief Gets the singleton instance
+ * 
+ * Implements thread-safe singleton pattern using double-checked locking.
+ * @return AssetCache& Reference to the singleton instance
+ */
+AssetCache& AssetCache::GetInstance() {
+    if (!instance) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!instance) {
+            instance.reset(new AssetCache());
+        }
+    }
+    return *instance;
+}
+
+/**
+ * @brief Private constructor for singleton pattern
+ * 
+ * Looks for the bundle beside the executable first, so the game finds it
+ * however it is launched, then in the working directory. Builds with
+ * embedded assets skip the search and never touch the filesystem.
+ */
+AssetCache::AssetCache() {
+    if (EmbeddedAssets::IsAvailable()) {
+        return;
+    }
+
+    char exePath[4096];
+    ssize_t length = readlink("/proc/self/exe", exePath, sizeof(exePath) - 1);
+    if (length > 0) {
+        std::string dirPath(exePath, static_cast<size_t>(length));
+        dirPath.erase(dirPath.find_last_of('/') + 1);
+        if (bundle.Open(dirPath + AssetBundleFormat::FILE_NAME)) {
+            return;
+        }
+    }
+    bundle.Open(AssetBundleFormat::FILE_NAME);
+}
+
+/**
+ * @brief Reads a file from disk into the cache
+ * @param path Path to the file
+ * @return const std::string& The cached contents
+ * @throw std::runtime_error if the file cannot be opened
+ */
+const std::string& AssetCache::Load(const std::string& path) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        throw std::runtime_error("Failed to open UI file: " + path);
+    }
+
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    return assets[path] = buffer.str();
+}
+
+/**
+ * @brief Gets the contents of an asset file
+ * 
+ * Looks the path up in the embedded assets, the bundle, then the loose
+ * file cache, and only falls back to the disk on the first request.
+ * @param path Path to the asset file
+ * @return std::string_view The file contents
+ * @throw std::runtime_error if the file cannot be opened
+ */
+std::string_view AssetCache::Get(const std::string& path) {
+    std::string_view packed;
+    if (EmbeddedAssets::Find(path, packed) || (bundle.IsOpen() && bundle.Find(path, packed))) {
+        return packed;
+    }
+
+    auto it = assets.find(path);
+    if (it != assets.end()) {
+        return it->second;
+    }
+    return Load(path);
+}
+
+/**
+ * @brief Gets the measured layout of an asset file
+ * 
+ * Builds the layout from the cached text the first time it is requested.
+ * @param path Path to the asset file
+ * @return const ScreenLayout& The layout of the file
+ * @throw std::runtime_error if the file cannot be opened
+ */
+const ScreenLayout& AssetCache::GetLayout(const std::string& path) {
+    auto it = layouts.find(path);
+    if (it != layouts.end()) {
+        return it->second;
+    }
+    return layouts.emplace(path, ScreenLayout(Get(path))).first->second;
+}
+
+/**
+ * @brief Loads every .txt file below a directory
+ * 
+ * Recurses into subdirectories and skips hidden entries.
+ * Files already in the cache are not read again.
+ * @param dirPath Path to the directory to preload
+ * @return size_t Number of loose files newly loaded
+ * @throw std::runtime_error if the directory cannot be opened
+ */
+size_t AssetCache::Preload(const std::string& dirPath) {
+    if (EmbeddedAssets::CountBelow(dirPath) > 0 || (bundle.IsOpen() && bundle.CountBelow(dirPath) > 0)) {
+        return 0;
+    }
+
+    DIR* dir = opendir(dirPath.c_str());
+    if (!dir) {
+        throw std::runtime_error("Cannot open asset directory: " + dirPath);
+    }
+
+    std::vector<std::string> names;
+    struct dirent* entry;
+    while ((entry = readdir(dir)) != nullptr) {
+        if (entry->d_name[0] != '.') {
+            names.emplace_back(entry->d_name);
+        }
+    }
+    closedir(dir);
+
+    size_t loaded = 0;
+    for (const auto& name : names) {
+        std::string path = dirPath + "/" + name;
+        struct stat info;
+        if (stat(path.c_str(), &info) != 0) {
+            continue;
+        }
+
+        if (S_ISDIR(info.st_mode)) {
+            loaded += Preload(path);
+        } else if (name.size() > 4 && name.compare(name.size() - 4, 4, ".txt") == 0 &&
+                   assets.find(path) == assets.end()) {
+            Load(path);
+            loaded++;
+        }
+    }
+    return loaded;
+}
+
+/**
+ * @brief Lists the .txt files directly inside an asset directory
+ * 
+ * Uses the embedded table or the bundle index when the directory is
+ * packed and reads the directory from disk otherwise.
+ * @param dirPath Path to the directory
+ * @return std::vector<std::string> File names, without the directory part
+ * @throw std::runtime_error if the directory is neither packed nor on disk
+ */
+std::vector<std::string> AssetCache::List(const std::string& dirPath) {
+    if (EmbeddedAssets::IsAvailable()) {
+        auto names = EmbeddedAssets::List(dirPath);
+        if (!names.empty()) {
+            return names;
+        }
+    }
+    if (bundle.IsOpen()) {
+        auto names = bundle.List(dirPath);
+        if (!names.empty()) {
+            return names;
+        }
+    }
+
+    DIR* dir = opendir(dirPath.c_str());
+    if (!dir) {
+        throw std::runtime_error("Cannot open asset directory: " + dirPath);
+    }
+
+    std::vector<std::string> names;
+    struct dirent* entry;
+    while ((entry = readdir(dir)) != nullptr) {
+        std::string name(entry->d_name);
+        if (name[0] != '.' && name.size() > 4 && name.compare(name.size() - 4, 4, ".txt") == 0) {
+            names.push_back(name);
+        }
+    }
+    closedir(dir);
+    return names;
+}
@@ -0,0 +1,117 @@
+/**
+ * @file AssetCache.h
+ * @brief In-memory cache for UI screens and animation frames
+ * 
+ * This file defines the AssetCache class, which keeps the contents of the
+ * text assets under ui/ and anim/ in memory so each file is read from disk
+ * at most once. It provides:
+ * - Zero-copy access to assets compiled into the binary (EMBED_ASSETS
+ *   builds) or to the packed asset bundle installed next to it, falling
+ *   back to loose files otherwise
+ * - Lazy loading of individual files keyed by path
+ * - Zero-copy access through std::string_view
+ * - Pre-split, pre-measured ScreenLayout objects built once per asset
+ * - Optional preloading of whole directory trees at startup
+ * 
+ * The AssetCache class implements the Singleton pattern so every screen
+ * shares the same loaded data.
+ * 
+ * @see UI
+ * @see Animation
+ */
+
+#pragma once
+#include "ScreenLayout.h"
+#include "AssetBundle.h"
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <mutex>
+#include <memory>
+
+class AssetCache {
+private:
+    static std::unique_ptr<AssetCache> instance;  ///< Singleton instance
+    static std::mutex mutex;                      ///< Mutex for thread safety
+
+    AssetBundle bundle;  ///< Packed assets, used first when open
+
+    /// Loose file contents keyed by path; nodes never move, so views stay valid
+    std::unordered_map<std::string, std::string> assets;
+    /// Layouts built from the cached assets, keyed by the same path
+    std::unordered_map<std::string, ScreenLayout> layouts;
+
+    /**
+     * @brief Private constructor for singleton pattern
+     * 
+     * Opens the asset bundle next to the game binary, or in the working
+     * directory, if one exists and no assets are embedded.
+     */
+    AssetCache();
+
+    /// Deleted copy constructor and assignment operator
+    AssetCache(const AssetCache&) = delete;
+    AssetCache& operator=(const AssetCache&) = delete;
+
+    /// Friend declaration for unique_ptr deleter
+    friend struct std::default_delete<AssetCache>;
+
+    /**
+     * @brief Reads a file from disk into the cache
+     * @param path Path to the file
+     * @return const std::string& The cached contents
+     * @throw std::runtime_error if the file cannot be opened
+     */
+    const std::string& Load(const std::string& path);
+
+public:
+    /**
+     * @brief Gets the singleton instance
+     * @return AssetCache& Reference to the singleton instance
+     */
+    static AssetCache& GetInstance();
+
+    /**
+     * @brief Gets the contents of an asset file
+     * 
+     * Serves the file from the embedded assets or the bundle if it is
+     * packed there; otherwise
+     * reads the loose file on first use and serves it from memory afterwards.
+     * The returned view stays valid for the lifetime of the program.
+     * @param path Path to the asset file
+     * @return std::string_view The file contents
+     * @throw std::runtime_error if the file cannot be opened
+     */
+    std::string_view Get(const std::string& path);
+
+    /**
+     * @brief Gets the measured layout of an asset file
+     * 
+     * The layout is built on first use and shared afterwards.
+     * @param path Path to the asset file
+     * @return const ScreenLayout& The layout of the file
+     * @throw std::runtime_error if the file cannot be opened
+     */
+    const ScreenLayout& GetLayout(const std::string& path);
+
+    /**
+     * @brief Loads every .txt file below a directory
+     * 
+     * Walks the directory tree recursively so that no disk access is
+     * needed later when its screens are shown. Directories that are
+     * embedded or in the bundle are already resident and are not walked.
+     * @param dirPath Path to the directory to preload
+     * @return size_t Number of loose files newly loaded
+     * @throw std::runtime_error if the directory cannot be opened
+     */
+    size_t Preload(const std::string& dirPath);
+
+    /**
+     * @brief Lists the .txt files directly inside an asset directory
+     * @param dirPath Path to the directory
+     * @return std::vector<std::string> File names, without the directory part
+     * @throw std::runtime_error if the directory is neither packed nor on disk
+     */
+    std::vector<std::string> List(const std::string& dirPath);
+};
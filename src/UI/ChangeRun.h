@@ -0,0 +1,42 @@
+/**
+ * @file ChangeRun.h
+ * @brief Grouping of nearby changes into runs sent with one cursor move
+ *
+ * Both the live frame buffer and the pre-rendered animation clips send
+ * only what changed since the previous frame. A cursor move costs more
+ * bytes than resending a few unchanged characters, so changes separated
+ * by a short unchanged gap are merged into a single run.
+ *
+ * @see FrameBuffer
+ * @see AnimationClip
+ */
+
+#pragma once
+
+/**
+ * @brief Extends a run of changes over short unchanged gaps
+ *
+ * The run starts at a changed position and takes in every later change
+ * that follows the previous one with at most maxGap unchanged positions
+ * in between.
+ * @tparam IsChanged Callable taking an int position, true if it changed
+ * @param isChanged Tells whether a position changed
+ * @param start First position of the run, which must be changed
+ * @param end One past the last position that may join the run
+ * @param maxGap Longest run of unchanged positions that is bridged
+ * @return int One past the last changed position of the run
+ */
+template <typename IsChanged>
+int ExtendChangeRun(IsChanged isChanged, int start, int end, int maxGap) {
+    int runEnd = start + 1;
+    int gap = 0;
+    for (int i = runEnd; i < end && gap <= maxGap; i++) {
+        if (isChanged(i)) {
+            runEnd = i + 1;
+            gap = 0;
+        } else {
+            gap++;
+        }
+    }
+    return runEnd;
+}
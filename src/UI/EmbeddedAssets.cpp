@@ -0,0 +1,100 @@
+/**
+ * @file EmbeddedAssets.cpp
+ * @brief Lookup over the assets compiled into the binary
+ * @details Includes the table generated by the asset packer when the
+ *          game is built with CT_EMBED_ASSETS, and an empty table otherwise.
+ */
+#include "EmbeddedAssets.h"
+#include <algorithm>
+#include <array>
+
+#ifdef CT_EMBED_ASSETS
+// Generated by asset_packer --cpp; defines EmbeddedAssets::TABLE sorted by hash
+#include "EmbeddedAssetData.h"
+#else
+namespace EmbeddedAssets {
+    constexpr std::array<Asset, 0> TABLE{};
+}
+#endif
+
+namespace EmbeddedAssets {
+
+/**
+ * @brief Checks at compile time that the table is sorted by unique hash
+ * @return bool True if binary search by hash is valid for TABLE
+ */
+constexpr bool IsSortedByHash() {
+    for (size_t i = 1; i < TABLE.size(); i++) {
+        if (TABLE[i - 1].hash >= TABLE[i].hash) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(IsSortedByHash(), "Embedded asset table must be sorted by unique path hash");
+
+/**
+ * @brief Checks whether the game was built with embedded assets
+ * @return bool True if the table holds any assets
+ */
+bool IsAvailable() {
+    return !TABLE.empty();
+}
+
+/**
+ * @brief Looks up an embedded file
+ *
+ * Binary-searches the table by path hash and confirms the path itself,
+ * so a hash collision with an unknown path cannot return wrong data.
+ * @param path Path of the file
+ * @param contents Set to a view of the file contents if found
+ * @return bool True if the file is embedded
+ */
+bool Find(std::string_view path, std::string_view& contents) {
+    uint64_t hash = HashPath(path);
+    auto it = std::lower_bound(TABLE.begin(), TABLE.end(), hash,
+                               [](const Asset& asset, uint64_t key) { return asset.hash < key; });
+    if (it == TABLE.end() || it->hash != hash || it->path != path) {
+        return false;
+    }
+    contents = it->contents;
+    return true;
+}
+
+/**
+ * @brief Lists the files directly inside an embedded directory
+ *
+ * The table is ordered by hash rather than path, so every entry is
+ * checked; this runs once per animation clip.
+ * @param dirPath Directory path without trailing slash
+ * @return std::vector<std::string> File names, without the directory part
+ */
+std::vector<std::string> List(std::string_view dirPath) {
+    std::vector<std::string> names;
+    std::string prefix = std::string(dirPath) + "/";
+
+    for (const auto& asset : TABLE) {
+        if (asset.path.compare(0, prefix.size(), prefix) == 0) {
+            std::string_view name = asset.path.substr(prefix.size());
+            if (name.find('/') == std::string_view::npos) {
+                names.emplace_back(name);
+            }
+        }
+    }
+    return names;
+}
+
+/**
+ * @brief Counts the files anywhere below an embedded directory
+ * @param dirPath Directory path without trailing slash
+ * @return size_t Number of files
+ */
+size_t CountBelow(std::string_view dirPath) {
+    std::string prefix = std::string(dirPath) + "/";
+    return static_cast<size_t>(std::count_if(TABLE.begin(), TABLE.end(), [&prefix](const Asset& asset) {
+        return asset.path.compare(0, prefix.size(), prefix) == 0;
+    }));
+}
+
+}
@@ -0,0 +1,80 @@
+/**
+ * @file EmbeddedAssets.h
+ * @brief Game assets compiled into the binary as constant data
+ *
+ * When the game is built with the EMBED_ASSETS option, the asset packer
+ * turns every text asset under ui/ and anim/ into constexpr data that is
+ * compiled into the executable. This file declares the lookup interface:
+ * - Assets are found by a hash of their path, computed at compile time
+ *   for the table and once per lookup for the requested path
+ * - Contents are views into read-only data, never copied
+ *
+ * Without the option the table is empty and every lookup fails, so
+ * callers fall back to the asset bundle or loose files.
+ *
+ * @see AssetCache
+ * @see AssetBundle
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace EmbeddedAssets {
+    /**
+     * @brief One embedded asset file
+     */
+    struct Asset {
+        uint64_t hash;              ///< HashPath(path)
+        std::string_view path;      ///< Path as packed (e.g. "ui/empty.txt")
+        std::string_view contents;  ///< File contents
+    };
+
+    /**
+     * @brief Hashes an asset path (64-bit FNV-1a)
+     *
+     * Usable in constant expressions, so the embedded table is keyed
+     * by the compiler rather than at startup.
+     * @param path Asset path
+     * @return uint64_t Hash of the path
+     */
+    constexpr uint64_t HashPath(std::string_view path) {
+        uint64_t hash = 14695981039346656037ull;
+        for (char ch : path) {
+            hash ^= static_cast<unsigned char>(ch);
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    /**
+     * @brief Checks whether the game was built with embedded assets
+     * @return bool True if the table holds any assets
+     */
+    bool IsAvailable();
+
+    /**
+     * @brief Looks up an embedded file
+     * @param path Path of the file (e.g. "ui/empty.txt")
+     * @param contents Set to a view of the file contents if found
+     * @return bool True if the file is embedded
+     */
+    bool Find(std::string_view path, std::string_view& contents);
+
+    /**
+     * @brief Lists the files directly inside an embedded directory
+     * @param dirPath Directory path without trailing slash (e.g. "anim/Title")
+     * @return std::vector<std::string> File names, without the directory part
+     */
+    std::vector<std::string> List(std::string_view dirPath);
+
+    /**
+     * @brief Counts the files anywhere below an embedded directory
+     * @param dirPath Directory path without trailing slash
+     * @return size_t Number of files
+     */
+    size_t CountBelow(std::string_view dirPath);
+}
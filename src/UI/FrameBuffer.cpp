@@ -0,0 +1,216 @@
+/**
+ * @file FrameBuffer.cpp
+ * @brief Implementation of the double-buffered character grid
+ * @details Tracks the terminal contents of a screen region and emits
+ *          escape sequences only for the cells that changed.
+ */
+#include "FrameBuffer.h"
+#include "ChangeRun.h"
+#include "Terminal.h"
+#include <algorithm>
+
+/// Marks a front buffer cell whose terminal contents are unknown
+static const char UNKNOWN_CELL = '\0';
+
+/**
+ * @brief Gets the SGR parameter that selects a foreground color
+ * @param color Color to select
+ * @return int 39 for the default color, 30-37 or 90-97 otherwise
+ */
+static int ForegroundCode(Color color) {
+    int index = static_cast<int>(color);
+    if (color == Color::DEFAULT) {
+        return 39;
+    }
+    return index <= static_cast<int>(Color::WHITE) ? 29 + index : 81 + index;
+}
+
+/**
+ * @brief Appends the color change from the current colors to the wanted ones
+ *
+ * Only the parameters that change are sent, together in one sequence;
+ * returning to both defaults from two other colors is a plain reset.
+ * @param terminal Terminal to append to
+ * @param foreground Foreground color wanted
+ * @param background Background color wanted
+ * @param currentForeground Foreground color in effect, updated
+ * @param currentBackground Background color in effect, updated
+ */
+static void AppendColorChange(Terminal& terminal, Color foreground, Color background,
+                              Color& currentForeground, Color& currentBackground) {
+    // Background codes are the foreground codes plus ten
+    bool foregroundChanges = foreground != currentForeground;
+    bool backgroundChanges = background != currentBackground;
+    if (foregroundChanges && backgroundChanges) {
+        if (foreground == Color::DEFAULT && background == Color::DEFAULT) {
+            terminal.AppendColor({0});
+        } else {
+            terminal.AppendColor({ForegroundCode(foreground), ForegroundCode(background) + 10});
+        }
+    } else if (foregroundChanges) {
+        terminal.AppendColor({ForegroundCode(foreground)});
+    } else if (backgroundChanges) {
+        terminal.AppendColor({ForegroundCode(background) + 10});
+    }
+    currentForeground = foreground;
+    currentBackground = background;
+}
+
+/**
+ * @brief Constructs a frame buffer of the given size
+ * @param width Number of columns in the region
+ * @param height Number of rows in the region
+ */
+FrameBuffer::FrameBuffer(int width, int height)
+    : width(width), height(height), originX(1), originY(1),
+      front(static_cast<size_t>(width * height), Cell{UNKNOWN_CELL, Color::DEFAULT, Color::DEFAULT}),
+      back(static_cast<size_t>(width * height), Cell{' ', Color::DEFAULT, Color::DEFAULT}) {}
+
+/**
+ * @brief Sets the terminal position of the top-left cell
+ * @param left 1-based terminal column of cell (0, 0)
+ * @param top 1-based terminal row of cell (0, 0)
+ */
+void FrameBuffer::SetOrigin(int left, int top) {
+    if (left != originX || top != originY) {
+        originX = left;
+        originY = top;
+        Invalidate();
+    }
+}
+
+/**
+ * @brief Fills a rectangle of the back buffer, clipped to the region
+ * @param x Left column within the region
+ * @param y Top row within the region
+ * @param rectWidth Number of columns
+ * @param rectHeight Number of rows
+ * @param fill Character to fill with
+ */
+void FrameBuffer::ClearRect(int x, int y, int rectWidth, int rectHeight, char fill) {
+    int left = std::max(0, x);
+    int right = std::min(width, x + rectWidth);
+    int top = std::max(0, y);
+    int bottom = std::min(height, y + rectHeight);
+    if (left >= right || top >= bottom) {
+        return;
+    }
+    for (int row = top; row < bottom; row++) {
+        std::fill(back.begin() + row * width + left, back.begin() + row * width + right,
+                  Cell{fill, Color::DEFAULT, Color::DEFAULT});
+    }
+}
+
+/**
+ * @brief Places a single character in the back buffer
+ * @param x Column within the region
+ * @param y Row within the region
+ * @param ch Character to place
+ * @param foreground Color of the character
+ * @param background Color behind the character
+ */
+void FrameBuffer::Put(int x, int y, char ch, Color foreground, Color background) {
+    if (x >= 0 && x < width && y >= 0 && y < height) {
+        back[y * width + x] = Cell{ch, foreground, background};
+    }
+}
+
+/**
+ * @brief Writes a string into the back buffer, clipped to the region
+ * @param x Column of the first character within the region
+ * @param y Row within the region
+ * @param text Text to write
+ * @param foreground Color of the text
+ * @param background Color behind the text
+ */
+void FrameBuffer::PutText(int x, int y, const std::string& text, Color foreground, Color background) {
+    for (size_t i = 0; i < text.length(); i++) {
+        Put(x + static_cast<int>(i), y, text[i], foreground, background);
+    }
+}
+
+/**
+ * @brief Forgets what the terminal is showing
+ */
+void FrameBuffer::Invalidate() {
+    std::fill(front.begin(), front.end(), Cell{UNKNOWN_CELL, Color::DEFAULT, Color::DEFAULT});
+}
+
+/**
+ * @brief Sends the changed cells to the terminal
+ *
+ * Scans each row for cells that differ from the front buffer. Nearby
+ * changes are merged into one run so that short unchanged gaps are
+ * rewritten instead of paying for another cursor move. Cells that fall
+ * outside the terminal (column or row below 1) are clipped. Colors are
+ * tracked across runs and rows, starting from and returning to the
+ * terminal defaults. Within a run, each span of cells sharing their colors
+ * is appended as one piece of text after a single color change.
+ */
+void FrameBuffer::Present() {
+    auto& terminal = Terminal::GetInstance();
+    Color currentForeground = Color::DEFAULT;
+    Color currentBackground = Color::DEFAULT;
+
+    int firstColumn = std::max(0, 1 - originX);
+    int firstRow = std::max(0, 1 - originY);
+
+    for (int y = firstRow; y < height; y++) {
+        const Cell* backRow = &back[y * width];
+        Cell* frontRow = &front[y * width];
+
+        int x = firstColumn;
+        while (x < width) {
+            if (backRow[x] == frontRow[x]) {
+                x++;
+                continue;
+            }
+
+            int runStart = x;
+            int runEnd = ExtendChangeRun([&](int i) { return backRow[i] != frontRow[i]; },
+                                         runStart, width, MAX_GAP);
+
+            // Send the run as spans of cells that share their colors
+            terminal.AppendCursorMove(originX + runStart, originY + y);
+            int spanStart = runStart;
+            while (spanStart < runEnd) {
+                const Cell& first = backRow[spanStart];
+                int spanEnd = spanStart + 1;
+                while (spanEnd < runEnd && backRow[spanEnd].foreground == first.foreground &&
+                       backRow[spanEnd].background == first.background) {
+                    spanEnd++;
+                }
+                AppendColorChange(terminal, first.foreground, first.background,
+                                  currentForeground, currentBackground);
+                spanText.clear();
+                for (int i = spanStart; i < spanEnd; i++) {
+                    spanText += backRow[i].ch;
+                }
+                terminal.AppendText(spanText);
+                spanStart = spanEnd;
+            }
+            std::copy(backRow + runStart, backRow + runEnd, frontRow + runStart);
+
+            x = runEnd;
+        }
+    }
+
+    AppendColorChange(terminal, Color::DEFAULT, Color::DEFAULT, currentForeground, currentBackground);
+    terminal.Flush();
+}
+
+/**
+ * @brief Gets the region width
+ * @return int Number of columns
+ */
+int FrameBuffer::GetWidth() const {
+    return width;
+}
+
+/**
+ * @brief Gets the region height
+ * @return int Number of rows
+ */
+int FrameBuffer::GetHeight() const {
+    return height;
+}
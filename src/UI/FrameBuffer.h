@@ -0,0 +1,158 @@
+/**
+ * @file FrameBuffer.h
+ * @brief Double-buffered character grid for flicker-free partial redraws
+ *
+ * This file defines the FrameBuffer class, which keeps two copies of a
+ * rectangular region of the terminal:
+ * - Back buffer: the frame currently being composed
+ * - Front buffer: what the terminal is known to be showing
+ *
+ * When a frame is presented only the cells that differ between the two
+ * buffers are sent to the terminal, so a frame in which a handful of
+ * zombies moved costs a handful of bytes instead of a full repaint.
+ * Each cell also carries a foreground and background color; the emitter
+ * tracks the terminal's current colors and only sends the SGR changes
+ * needed between cells, so colored output costs little over plain text.
+ *
+ * @see Terminal
+ * @see Combat
+ */
+
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Terminal colors a cell can be drawn in
+ *
+ * DEFAULT is the terminal's own foreground or background color.
+ */
+enum class Color : uint8_t {
+    DEFAULT,
+    BLACK, RED, GREEN, YELLOW, BLUE, MAGENTA, CYAN, WHITE,
+    BRIGHT_BLACK, BRIGHT_RED, BRIGHT_GREEN, BRIGHT_YELLOW,
+    BRIGHT_BLUE, BRIGHT_MAGENTA, BRIGHT_CYAN, BRIGHT_WHITE
+};
+
+class FrameBuffer {
+public:
+    /**
+     * @brief Constructs a frame buffer of the given size
+     *
+     * The front buffer starts out invalid, so the first Present()
+     * paints every cell.
+     * @param width Number of columns in the region
+     * @param height Number of rows in the region
+     */
+    FrameBuffer(int width, int height);
+
+    /**
+     * @brief Sets the terminal position of the top-left cell
+     *
+     * Moving the region invalidates the front buffer, as the terminal
+     * contents at the new position are unknown.
+     * @param left 1-based terminal column of cell (0, 0)
+     * @param top 1-based terminal row of cell (0, 0)
+     */
+    void SetOrigin(int left, int top);
+
+    /**
+     * @brief Fills a rectangle of the back buffer with a character in default colors
+     *
+     * Lets a caller keep static content in the back buffer between frames
+     * and only blank the part it redraws. The rectangle is clipped to the
+     * region; nothing is filled if no part of it lies inside.
+     * @param x Left column within the region
+     * @param y Top row within the region
+     * @param rectWidth Number of columns
+     * @param rectHeight Number of rows
+     * @param fill Character to fill with
+     */
+    void ClearRect(int x, int y, int rectWidth, int rectHeight, char fill = ' ');
+
+    /**
+     * @brief Places a single character in the back buffer
+     *
+     * Coordinates outside the region are ignored.
+     * @param x Column within the region
+     * @param y Row within the region
+     * @param ch Character to place
+     * @param foreground Color of the character
+     * @param background Color behind the character
+     */
+    void Put(int x, int y, char ch, Color foreground = Color::DEFAULT, Color background = Color::DEFAULT);
+
+    /**
+     * @brief Writes a string into the back buffer
+     *
+     * The text is clipped to the region.
+     * @param x Column of the first character within the region
+     * @param y Row within the region
+     * @param text Text to write
+     * @param foreground Color of the text
+     * @param background Color behind the text
+     */
+    void PutText(int x, int y, const std::string& text,
+                 Color foreground = Color::DEFAULT, Color background = Color::DEFAULT);
+
+    /**
+     * @brief Forgets what the terminal is showing
+     *
+     * Call after anything else has drawn over the region (e.g. a pause
+     * screen); the next Present() repaints every cell.
+     */
+    void Invalidate();
+
+    /**
+     * @brief Sends the changed cells to the terminal
+     *
+     * Appends one cursor move per run of changed cells to the terminal
+     * output buffer, with color changes (through Terminal::AppendColor)
+     * only where a cell's colors differ from the previous cell sent,
+     * writes the whole frame with a single flush and makes the back
+     * buffer the new front. The terminal is left in its default colors.
+     */
+    void Present();
+
+    /**
+     * @brief Gets the region width
+     * @return int Number of columns
+     */
+    int GetWidth() const;
+
+    /**
+     * @brief Gets the region height
+     * @return int Number of rows
+     */
+    int GetHeight() const;
+
+private:
+    /// Gaps of at most this many unchanged cells between two changes are
+    /// resent rather than skipped, as a cursor move costs more bytes
+    static constexpr int MAX_GAP = 6;
+
+    /**
+     * @brief A character and its colors
+     */
+    struct Cell {
+        char ch;           ///< Character shown
+        Color foreground;  ///< Color of the character
+        Color background;  ///< Color behind the character
+
+        bool operator==(const Cell& other) const {
+            return ch == other.ch && foreground == other.foreground && background == other.background;
+        }
+        bool operator!=(const Cell& other) const {
+            return !(*this == other);
+        }
+    };
+
+    int width;                  ///< Region width in cells
+    int height;                 ///< Region height in cells
+    int originX;                ///< Terminal column of cell (0, 0)
+    int originY;                ///< Terminal row of cell (0, 0)
+    std::vector<Cell> front;    ///< Cells currently shown by the terminal
+    std::vector<Cell> back;     ///< Cells of the frame being composed
+    std::string spanText;       ///< Characters of the span being sent, reused between frames
+};
@@ -0,0 +1,361 @@
+/**
+ * @file InputSource.cpp
+ * @brief Implementation of the terminal, queue and script input sources
+ * @details Holds the process-wide current input source, which defaults
+ *          to the terminal.
+ */
+#include "InputSource.h"
+#include <sys/ioctl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <fstream>
+#include <stdexcept>
+
+/// Input source used when none has been set
+static TerminalInput terminalInput;
+
+/// Input source the game currently reads from
+static InputSource* currentSource = &terminalInput;
+
+/**
+ * @brief Gets the input source the game currently reads from
+ * @return InputSource& The current source
+ */
+InputSource& InputSource::Get() {
+    return *currentSource;
+}
+
+/**
+ * @brief Replaces the input source the game reads from
+ * @param source New source, or nullptr for the terminal
+ */
+void InputSource::Set(InputSource* source) {
+    currentSource = source ? source : &terminalInput;
+}
+
+/**
+ * @brief Reads the next key, decoding escape sequences
+ * 
+ * A sequence is ESC followed by '[' (CSI) with parameter, intermediate
+ * and final bytes, or by 'O' (SS3) and a single final byte. Each byte
+ * must follow the previous one within ESCAPE_TIMEOUT; a sequence cut
+ * short is reported as KEY_UNKNOWN.
+ * @return int The decoded key
+ * @throws InputClosedException if no more keys will arrive
+ */
+int InputSource::ReadKey() {
+    int ch = ReadChar();
+    if (ch != KEY_ESCAPE) {
+        return ch;
+    }
+
+    auto nextByteArrives = [this] {
+        return WaitForInput(Clock::Get().Now() + ESCAPE_TIMEOUT);
+    };
+
+    // A lone escape, or escape followed by an ordinary key
+    if (!nextByteArrives()) {
+        return KEY_ESCAPE;
+    }
+    int introducer = PeekChar();
+    if (introducer != '[' && introducer != 'O') {
+        return KEY_ESCAPE;
+    }
+    ReadChar();
+
+    // CSI parameters and intermediates run from 0x20 to 0x3F
+    int finalByte;
+    do {
+        if (!nextByteArrives()) {
+            return KEY_UNKNOWN;
+        }
+        finalByte = ReadChar();
+    } while (introducer == '[' && finalByte >= 0x20 && finalByte <= 0x3F);
+
+    switch (finalByte) {
+        case 'A': return KEY_UP;
+        case 'B': return KEY_DOWN;
+        case 'C': return KEY_RIGHT;
+        case 'D': return KEY_LEFT;
+        default: return KEY_UNKNOWN;
+    }
+}
+
+/**
+ * @brief Reads one key from standard input
+ * 
+ * Late replies to the startup terminal queries are skipped.
+ * @return int The key's character code
+ * @throws InputClosedException if standard input is closed
+ */
+int TerminalInput::ReadChar() {
+    while (true) {
+        int ch = ReadByte();
+        if (ch != KEY_ESCAPE || !SkipTerminalReport()) {
+            return ch;
+        }
+    }
+}
+
+/**
+ * @brief Reads one byte, from readAhead first
+ * @return int The byte
+ * @throws InputClosedException if standard input is closed
+ */
+int TerminalInput::ReadByte() {
+    if (!readAhead.empty()) {
+        unsigned char ch = static_cast<unsigned char>(readAhead.front());
+        readAhead.erase(0, 1);
+        return ch;
+    }
+
+    unsigned char ch;
+    ssize_t result;
+    do {
+        result = read(STDIN_FILENO, &ch, 1);
+    } while (result < 0 && errno == EINTR);
+    if (result <= 0) {
+        throw InputClosedException();
+    }
+    return ch;
+}
+
+/**
+ * @brief Drops a terminal report whose escape was just read
+ * 
+ * A terminal writes a report in one go, so the rest of it is already
+ * waiting when its escape is read; nothing is waited for here.
+ * @return bool True if a report was dropped
+ */
+bool TerminalInput::SkipTerminalReport() {
+    int bytesWaiting = 0;
+    ioctl(STDIN_FILENO, FIONREAD, &bytesWaiting);
+    if (bytesWaiting > 0) {
+        char buffer[64];
+        ssize_t count = read(STDIN_FILENO, buffer, std::min(sizeof(buffer), static_cast<size_t>(bytesWaiting)));
+        if (count > 0) {
+            readAhead.append(buffer, static_cast<size_t>(count));
+        }
+    }
+
+    // ESC [ ? Ps ; ... c  or  ESC [ ? Ps ; Pm $ y
+    if (readAhead.size() < 3 || readAhead[0] != '[' || readAhead[1] != '?') {
+        return false;
+    }
+    size_t end = 2;
+    while (end < readAhead.size() && ((readAhead[end] >= '0' && readAhead[end] <= '9') || readAhead[end] == ';')) {
+        end++;
+    }
+    if (end < readAhead.size() && readAhead[end] == 'c') {
+        end += 1;
+    } else if (end + 1 < readAhead.size() && readAhead[end] == '$' && readAhead[end + 1] == 'y') {
+        end += 2;
+    } else {
+        return false;
+    }
+    readAhead.erase(0, end);
+    return true;
+}
+
+/**
+ * @brief Checks for bytes read ahead or unread bytes on standard input
+ * @return bool True if a key is waiting
+ */
+bool TerminalInput::HasInput() {
+    if (!readAhead.empty()) {
+        return true;
+    }
+    int bytesWaiting = 0;
+    ioctl(STDIN_FILENO, FIONREAD, &bytesWaiting);
+    return bytesWaiting > 0;
+}
+
+/**
+ * @brief Reads the next key ahead and keeps it for ReadChar
+ * @return int The key's character code
+ */
+int TerminalInput::PeekChar() {
+    int ch = ReadChar();
+    readAhead.insert(readAhead.begin(), static_cast<char>(ch));
+    return ch;
+}
+
+/**
+ * @brief Waits for standard input with poll(2)
+ * 
+ * The timeout is rounded up to whole milliseconds so the caller is not
+ * woken just before its deadline. When standard input is closed there
+ * is nothing to wait for, so the rest of the time is slept instead.
+ * @param deadline Latest time to return at
+ * @return bool True if a key is ready
+ */
+bool TerminalInput::WaitForInput(Clock::TimePoint deadline) {
+    if (!readAhead.empty()) {
+        return true;
+    }
+
+    Clock& clock = Clock::Get();
+    while (true) {
+        auto remaining = deadline - clock.Now();
+        int timeoutMs = remaining > Clock::Duration::zero()
+            ? static_cast<int>(std::chrono::ceil<std::chrono::milliseconds>(remaining).count())
+            : 0;
+
+        pollfd fd{STDIN_FILENO, POLLIN, 0};
+        int ready = poll(&fd, 1, timeoutMs);
+        if (ready < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ready <= 0) {
+            return false;
+        }
+        if (HasInput()) {
+            return true;
+        }
+        // Hang-up with no data left
+        clock.SleepUntil(deadline);
+        return false;
+    }
+}
+
+/**
+ * @brief Drops everything typed so far
+ * 
+ * Keys piped in from a file or another program are kept, since they
+ * were written for the prompts that follow.
+ */
+void TerminalInput::DiscardPending() {
+    if (!isatty(STDIN_FILENO)) {
+        return;
+    }
+    while (HasInput()) {
+        ReadChar();
+    }
+}
+
+/**
+ * @brief Queues keys to be read
+ * @param keys Characters to queue
+ */
+void QueueInput::Push(std::string_view keys) {
+    for (char key : keys) {
+        entries.push_back({key, pendingDelay});
+        pendingDelay = Clock::Duration::zero();
+    }
+}
+
+/**
+ * @brief Holds back the next queued key
+ * @param delay Time to wait after the previous read; consecutive delays add up
+ */
+void QueueInput::PushDelay(Clock::Duration delay) {
+    pendingDelay += delay;
+}
+
+/**
+ * @brief Gets the time the next key becomes available
+ *
+ * The first query starts the clock for a leading delay.
+ * @return Clock::TimePoint Release time of the front entry
+ */
+Clock::TimePoint QueueInput::NextReleaseTime() {
+    if (!lastRead) {
+        lastRead = Clock::Get().Now();
+    }
+    return *lastRead + entries.front().delay;
+}
+
+/**
+ * @brief Reads the next key, waiting out its delay
+ * @return int The key's character code
+ * @throws InputClosedException if the queue is empty
+ */
+int QueueInput::ReadChar() {
+    if (entries.empty()) {
+        throw InputClosedException();
+    }
+    Clock& clock = Clock::Get();
+    clock.SleepUntil(NextReleaseTime());
+
+    char key = entries.front().key;
+    entries.pop_front();
+    lastRead = clock.Now();
+    return static_cast<unsigned char>(key);
+}
+
+/**
+ * @brief Checks whether the next key is ready
+ * @return bool True if a key is queued and its delay has passed
+ */
+bool QueueInput::HasInput() {
+    return !entries.empty() && Clock::Get().Now() >= NextReleaseTime();
+}
+
+/**
+ * @brief Returns the next queued key without consuming it
+ * @return int The key's character code
+ * @throws InputClosedException if the queue is empty
+ */
+int QueueInput::PeekChar() {
+    if (entries.empty()) {
+        throw InputClosedException();
+    }
+    return static_cast<unsigned char>(entries.front().key);
+}
+
+/**
+ * @brief Sleeps until the next key is released or the deadline passes
+ * @param deadline Latest time to return at
+ * @return bool True if a key is ready
+ */
+bool QueueInput::WaitForInput(Clock::TimePoint deadline) {
+    Clock& clock = Clock::Get();
+    if (entries.empty() || NextReleaseTime() > deadline) {
+        clock.SleepUntil(deadline);
+        return false;
+    }
+    clock.SleepUntil(NextReleaseTime());
+    return true;
+}
+
+/**
+ * @brief Loads a script file into the queue
+ * @param path Path to the script
+ * @throw std::runtime_error if the file cannot be read or a directive is invalid
+ */
+ScriptInput::ScriptInput(const std::string& path) {
+    std::ifstream file(path);
+    if (!file) {
+        throw std::runtime_error("Failed to open input script: " + path);
+    }
+
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(file, line)) {
+        lineNumber++;
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+
+        if (!line.empty() && line[0] == '#') {
+            continue;
+        } else if (line.rfind("@keys ", 0) == 0) {
+            Push(std::string_view(line).substr(6));
+        } else if (line.rfind("@wait ", 0) == 0) {
+            char* end = nullptr;
+            long ms = std::strtol(line.c_str() + 6, &end, 10);
+            if (end == line.c_str() + 6 || *end != '\0' || ms < 0) {
+                throw std::runtime_error(path + ":" + std::to_string(lineNumber) + ": invalid wait: " + line);
+            }
+            PushDelay(std::chrono::milliseconds(ms));
+        } else if (!line.empty() && line[0] == '@') {
+            throw std::runtime_error(path + ":" + std::to_string(lineNumber) + ": unknown directive: " + line);
+        } else {
+            Push(line);
+            Push("\n");
+        }
+    }
+}
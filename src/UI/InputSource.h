@@ -0,0 +1,272 @@
+/**
+ * @file InputSource.h
+ * @brief Sources of key presses for the game
+ *
+ * This file defines the InputSource interface and its implementations:
+ * - TerminalInput: keys typed on the terminal (the default)
+ * - QueueInput: keys queued in memory, optionally spaced out in time
+ * - ScriptInput: a QueueInput loaded from a script file
+ *
+ * Every prompt, menu and combat tick reads its keys through
+ * InputSource::Get(), so the game can be driven without a keyboard.
+ * ReadKey decodes terminal escape sequences, so arrow keys arrive as
+ * single key codes rather than as ESC, '[' and a letter.
+ *
+ * @see Terminal
+ * @see Clock
+ */
+
+#pragma once
+#include "../Utils/Clock.h"
+#include <deque>
+#include <exception>
+#include <optional>
+#include <string>
+#include <string_view>
+
+/**
+ * @brief Exception thrown when an input source has no more keys to give
+ *
+ * Raised by a blocking read once a queue or script is exhausted, or once
+ * the terminal's standard input is closed, so waiting loops end instead
+ * of spinning forever.
+ */
+class InputClosedException : public std::exception {
+public:
+    const char* what() const noexcept override {
+        return "Input closed";
+    }
+};
+
+/**
+ * @class InputSource
+ * @brief Abstract source of key presses with a process-wide current instance
+ */
+class InputSource {
+public:
+    /// Key codes returned by ReadKey beyond the single-byte range
+    static constexpr int KEY_ESCAPE = 0x1B;   ///< Escape pressed on its own
+    static constexpr int KEY_UP = 0x101;      ///< Up arrow
+    static constexpr int KEY_DOWN = 0x102;    ///< Down arrow
+    static constexpr int KEY_RIGHT = 0x103;   ///< Right arrow
+    static constexpr int KEY_LEFT = 0x104;    ///< Left arrow
+    static constexpr int KEY_UNKNOWN = 0x1FF; ///< Escape sequence with no meaning here
+
+    /// Longest gap between the bytes of one escape sequence
+    static constexpr std::chrono::milliseconds ESCAPE_TIMEOUT{30};
+
+    virtual ~InputSource() = default;
+
+    /**
+     * @brief Reads the next key, waiting for it if necessary
+     * @return int The key's character code
+     * @throws InputClosedException if no more keys will arrive
+     */
+    virtual int ReadChar() = 0;
+
+    /**
+     * @brief Checks whether a key can be read without waiting
+     * @return bool True if ReadChar would return at once
+     */
+    virtual bool HasInput() = 0;
+
+    /**
+     * @brief Returns the next key without consuming it
+     *
+     * Only call when HasInput() is true, so the call does not wait.
+     * @return int The key's character code
+     * @throws InputClosedException if no more keys will arrive
+     */
+    virtual int PeekChar() = 0;
+
+    /**
+     * @brief Waits until a key can be read or the deadline passes
+     *
+     * Lets a frame loop sleep until its next deadline while still
+     * waking up as soon as a key arrives.
+     * @param deadline Latest time to return at
+     * @return bool True if a key is ready, false if the deadline passed
+     */
+    virtual bool WaitForInput(Clock::TimePoint deadline) = 0;
+
+    /**
+     * @brief Reads the next key, decoding escape sequences
+     *
+     * Arrow keys (CSI or SS3 sequences) come back as KEY_UP, KEY_DOWN,
+     * KEY_RIGHT or KEY_LEFT, other complete sequences as KEY_UNKNOWN, and
+     * an escape not followed by a sequence within ESCAPE_TIMEOUT as
+     * KEY_ESCAPE. All other keys come back as their character code.
+     * @return int The decoded key
+     * @throws InputClosedException if no more keys will arrive
+     */
+    int ReadKey();
+
+    /**
+     * @brief Drops keys typed ahead of a prompt
+     *
+     * Only keys typed by a person are dropped; queued keys are written
+     * for the prompts they answer and are kept.
+     */
+    virtual void DiscardPending() {}
+
+    /**
+     * @brief Checks whether keys may be read on a thread of their own
+     *
+     * Queued keys are released by the game clock, which a virtual clock
+     * only advances on the game thread, so only the terminal says yes.
+     * @return bool True if a KeyReader may read this source in the background
+     */
+    virtual bool SupportsBackgroundReads() const { return false; }
+
+    /**
+     * @brief Gets the input source the game currently reads from
+     * @return InputSource& The current source, a TerminalInput unless Set was called
+     */
+    static InputSource& Get();
+
+    /**
+     * @brief Replaces the input source the game reads from
+     *
+     * Meant to be called once at startup, before any other thread runs.
+     * @param source New source, owned by the caller; nullptr restores the terminal
+     */
+    static void Set(InputSource* source);
+};
+
+/**
+ * @class TerminalInput
+ * @brief Keys typed on the terminal's standard input
+ *
+ * Reads the file descriptor directly rather than through stdio, so no
+ * keys sit in a buffer where HasInput cannot see them, and waits for
+ * keys with poll(2) instead of checking repeatedly. Replies to the
+ * terminal queries sent at startup that arrive too late to be read by
+ * the query (device attributes, mode reports) are dropped rather than
+ * returned as keys.
+ */
+class TerminalInput : public InputSource {
+public:
+    int ReadChar() override;
+    bool HasInput() override;
+    int PeekChar() override;
+
+    /**
+     * @brief Waits for standard input with poll(2)
+     * @param deadline Latest time to return at
+     * @return bool True if a key is ready
+     */
+    bool WaitForInput(Clock::TimePoint deadline) override;
+
+    void DiscardPending() override;
+    bool SupportsBackgroundReads() const override { return true; }
+
+private:
+    std::string readAhead;  ///< Bytes read but not yet returned, oldest first
+
+    /**
+     * @brief Reads one byte, from readAhead first
+     * @return int The byte
+     * @throws InputClosedException if standard input is closed
+     */
+    int ReadByte();
+
+    /**
+     * @brief Drops a terminal report whose escape was just read
+     *
+     * Looks at the bytes that arrived with the escape; if they complete
+     * a device attributes reply ("[?...c") or a mode report ("[?...$y")
+     * they are dropped, otherwise they are kept for the next reads.
+     * @return bool True if a report was dropped
+     */
+    bool SkipTerminalReport();
+};
+
+/**
+ * @class QueueInput
+ * @brief Keys queued in memory
+ *
+ * Keys are handed out in the order they were pushed. A delay pushed
+ * before a key holds it back until that much clock time has passed
+ * since the previous key was read, which lets a script leave a combat
+ * wave to run on its own for a while.
+ */
+class QueueInput : public InputSource {
+public:
+    /**
+     * @brief Queues keys to be read
+     * @param keys Characters to queue, in order
+     */
+    void Push(std::string_view keys);
+
+    /**
+     * @brief Holds back the next queued key
+     * @param delay Clock time that must pass after the previous read
+     */
+    void PushDelay(Clock::Duration delay);
+
+    /**
+     * @brief Reads the next key, sleeping out its delay on the current clock
+     * @return int The key's character code
+     * @throws InputClosedException if the queue is empty
+     */
+    int ReadChar() override;
+
+    /**
+     * @brief Checks whether the next key is queued and its delay has passed
+     * @return bool True if a key is ready
+     */
+    bool HasInput() override;
+
+    /**
+     * @brief Returns the next queued key without consuming it
+     * @return int The key's character code
+     * @throws InputClosedException if the queue is empty
+     */
+    int PeekChar() override;
+
+    /**
+     * @brief Sleeps on the current clock until the next key is released
+     * @param deadline Latest time to return at
+     * @return bool True if a key is ready
+     */
+    bool WaitForInput(Clock::TimePoint deadline) override;
+
+private:
+    /**
+     * @brief A queued key and the delay before it
+     */
+    struct Entry {
+        char key;               ///< Character to hand out
+        Clock::Duration delay;  ///< Time to wait after the previous read
+    };
+
+    std::deque<Entry> entries;                  ///< Keys still to read
+    Clock::Duration pendingDelay{};             ///< Delay for the next pushed key
+    std::optional<Clock::TimePoint> lastRead;   ///< When the previous key was read
+
+    /**
+     * @brief Gets the time the next key becomes available
+     * @return Clock::TimePoint Release time of the front entry
+     */
+    Clock::TimePoint NextReleaseTime();
+};
+
+/**
+ * @class ScriptInput
+ * @brief Keys read from a script file
+ *
+ * Script format, one directive per line:
+ * - text: types the text followed by Enter (an empty line is just Enter)
+ * - \@keys text: types the text without Enter
+ * - \@wait ms: holds the next key back for ms milliseconds of game time
+ * - lines starting with '#' are comments
+ */
+class ScriptInput : public QueueInput {
+public:
+    /**
+     * @brief Loads a script file
+     * @param path Path to the script
+     * @throw std::runtime_error if the file cannot be read or a directive is invalid
+     */
+    explicit ScriptInput(const std::string& path);
+};
@@ -0,0 +1,34 @@
+/**
+ * @file KeyMap.cpp
+ * @brief Implementation of the key binding table
+ */
+#include "KeyMap.h"
+#include <cctype>
+#include <utility>
+
+/**
+ * @brief Binds an action to a key, in both cases for letters
+ * @param key Key to bind
+ * @param action Action to run
+ */
+void KeyMap::Bind(char key, Action action) {
+    unsigned char code = static_cast<unsigned char>(key);
+    if (std::isalpha(code)) {
+        actions[std::tolower(code)] = action;
+        actions[std::toupper(code)] = action;
+    } else {
+        actions[code] = std::move(action);
+    }
+}
+
+/**
+ * @brief Looks up the action bound to a key
+ * @param key Key code; codes outside the byte range are never bound
+ * @return const Action* Bound action, or nullptr
+ */
+const KeyMap::Action* KeyMap::Find(int key) const {
+    if (key < 0 || key >= static_cast<int>(actions.size()) || !actions[key]) {
+        return nullptr;
+    }
+    return &actions[key];
+}
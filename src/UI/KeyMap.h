@@ -0,0 +1,46 @@
+/**
+ * @file KeyMap.h
+ * @brief Table of actions bound to keys
+ *
+ * This file defines the KeyMap class, a 256-entry table mapping each
+ * single-byte key to an action. A screen builds one map for its hot keys
+ * (e.g. H to return home, L for player info) and pushes it onto the
+ * Terminal while it is shown; every prompt then looks keys up in the
+ * innermost map with a single index instead of a chain of comparisons.
+ *
+ * @see Terminal
+ * @see CounterBase
+ */
+
+#pragma once
+#include <array>
+#include <functional>
+
+/**
+ * @class KeyMap
+ * @brief Actions indexed by key code
+ */
+class KeyMap {
+public:
+    /// Action run when a bound key is read
+    using Action = std::function<void()>;
+
+    /**
+     * @brief Binds an action to a key
+     *
+     * Letters are bound in both cases, so 'h' also binds 'H'.
+     * @param key Key to bind
+     * @param action Action to run; replaces any earlier binding
+     */
+    void Bind(char key, Action action);
+
+    /**
+     * @brief Looks up the action bound to a key
+     * @param key Key code as returned by InputSource::ReadKey
+     * @return const Action* Bound action, or nullptr if the key is unbound
+     */
+    const Action* Find(int key) const;
+
+private:
+    std::array<Action, 256> actions;  ///< Action per byte value, empty when unbound
+};
@@ -0,0 +1,93 @@
+/**
+ * @file KeyReader.cpp
+ * @brief Implementation of the background key reader
+ * @details The reader thread only ever waits with a timeout, so a stop
+ *          request is noticed within STOP_CHECK_INTERVAL even when no key
+ *          is typed.
+ */
+#include "KeyReader.h"
+#include <functional>
+
+/**
+ * @brief Stops the reader thread if it is still running
+ */
+KeyReader::~KeyReader() {
+    Stop();
+}
+
+/**
+ * @brief Starts taking keys from the current input source
+ */
+void KeyReader::Start() {
+    InputSource& source = InputSource::Get();
+    if (reader.joinable() || !source.SupportsBackgroundReads()) {
+        return;
+    }
+    stopRequested = false;
+    reader = std::thread(&KeyReader::ReadLoop, this, std::ref(source));
+}
+
+/**
+ * @brief Stops taking keys and joins the reader thread
+ */
+void KeyReader::Stop() {
+    if (reader.joinable()) {
+        stopRequested = true;
+        reader.join();
+    }
+}
+
+/**
+ * @brief Takes the next key without waiting
+ * @param key Receives the decoded key
+ * @return bool False if no key is waiting
+ * @throws InputClosedException if a directly read source has no more keys
+ */
+bool KeyReader::Poll(int& key) {
+    if (keys.TryPop(key)) {
+        return true;
+    }
+    if (reader.joinable()) {
+        return false;
+    }
+    InputSource& source = InputSource::Get();
+    if (!source.HasInput()) {
+        return false;
+    }
+    key = source.ReadKey();
+    return true;
+}
+
+/**
+ * @brief Waits until a key may be waiting or the deadline passes
+ * @param deadline Latest time to return at
+ * @return bool True if Poll may return a key
+ */
+bool KeyReader::WaitForKey(Clock::TimePoint deadline) {
+    if (!keys.Empty()) {
+        return true;
+    }
+    if (!reader.joinable()) {
+        return InputSource::Get().WaitForInput(deadline);
+    }
+    Clock::Get().SleepUntil(deadline);
+    return false;
+}
+
+/**
+ * @brief Body of the reader thread
+ *
+ * Keys that arrive while the queue is full are dropped. A closed input
+ * ends the thread quietly; the loop then simply gets no more keys.
+ * @param source Input source to read
+ */
+void KeyReader::ReadLoop(InputSource& source) {
+    try {
+        while (!stopRequested) {
+            if (source.WaitForInput(Clock::Get().Now() + STOP_CHECK_INTERVAL)) {
+                keys.TryPush(source.ReadKey());
+            }
+        }
+    } catch (const InputClosedException&) {
+    }
+}
@@ -0,0 +1,94 @@
+/**
+ * @file KeyReader.h
+ * @brief Background reader that decodes keys into a lock-free queue
+ *
+ * This file defines the KeyReader class, which takes keys off the current
+ * input source for a real-time loop:
+ * - On the terminal, a reader thread decodes keys (escape sequences
+ *   included) as they are typed and pushes them into a SpscQueue
+ * - The loop drains every queued key once per tick without blocking,
+ *   so a held key never builds up a backlog behind the frame rate
+ * - Sources that cannot be read off the game thread (queued or scripted
+ *   keys on a virtual clock) are read directly instead, keeping scripted
+ *   runs deterministic
+ *
+ * While a reader is running nothing else may read the input source; stop
+ * it before showing a prompt.
+ *
+ * @see InputSource
+ * @see SpscQueue
+ * @see Combat
+ */
+
+#pragma once
+#include "InputSource.h"
+#include "../Utils/Clock.h"
+#include "../Utils/SpscQueue.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+/**
+ * @class KeyReader
+ * @brief Reads decoded keys for a real-time loop, off-thread when possible
+ */
+class KeyReader {
+public:
+    /// Decoded keys held between drains; later keys are dropped when full
+    static constexpr size_t QUEUE_CAPACITY = 64;
+
+    /// Longest the reader thread waits before checking for a stop request
+    static constexpr std::chrono::milliseconds STOP_CHECK_INTERVAL{20};
+
+    KeyReader() = default;
+    KeyReader(const KeyReader&) = delete;
+    KeyReader& operator=(const KeyReader&) = delete;
+
+    /**
+     * @brief Stops the reader thread if it is still running
+     */
+    ~KeyReader();
+
+    /**
+     * @brief Starts taking keys from the current input source
+     *
+     * Starts the reader thread if the source supports background reads.
+     */
+    void Start();
+
+    /**
+     * @brief Stops taking keys and joins the reader thread
+     *
+     * Keys already queued are kept for the next Poll.
+     */
+    void Stop();
+
+    /**
+     * @brief Takes the next key without waiting
+     * @param key Receives the decoded key
+     * @return bool False if no key is waiting
+     * @throws InputClosedException if a directly read source has no more keys
+     */
+    bool Poll(int& key);
+
+    /**
+     * @brief Waits until a key may be waiting or the deadline passes
+     *
+     * A directly read source wakes as soon as a key arrives; with a reader
+     * thread the caller sleeps until the deadline and drains afterwards.
+     * @param deadline Latest time to return at
+     * @return bool True if Poll may return a key
+     */
+    bool WaitForKey(Clock::TimePoint deadline);
+
+private:
+    SpscQueue<int, QUEUE_CAPACITY> keys;   ///< Keys decoded by the reader thread
+    std::thread reader;                    ///< Reader thread, if running
+    std::atomic<bool> stopRequested{false}; ///< Set to make the reader thread exit
+
+    /**
+     * @brief Body of the reader thread
+     * @param source Input source to read
+     */
+    void ReadLoop(InputSource& source);
+};
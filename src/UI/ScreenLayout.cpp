@@ -0,0 +1,128 @@
+/**
+ * @file ScreenLayout.cpp
+ * @brief Implementation of the pre-measured screen layout
+ * @details Splits screen text into lines and measures their UTF-8
+ *          visual widths once per asset.
+ */
+#include "ScreenLayout.h"
+#include <algorithm>
+
+/**
+ * @brief Calculates the visual width of a string considering UTF-8 characters
+ * 
+ * Handles multi-byte UTF-8 characters correctly when calculating display width.
+ * @param str The input string to measure
+ * @return size_t The visual width of the string
+ */
+size_t getVisualWidth(std::string_view str) {
+    size_t width = 0;
+    for (size_t i = 0; i < str.length(); i = nextCharacterOffset(str, i)) {
+        if ((str[i] & 0xC0) != 0x80) {  // Not a stray continuation byte at the start
+            width += 1;
+        }
+    }
+    return width;
+}
+
+/**
+ * @brief Finds where the UTF-8 character after the one at an offset starts
+ * @param str The string to step through
+ * @param offset Byte offset of a character
+ * @return size_t Byte offset of the next character, at most str.length()
+ */
+size_t nextCharacterOffset(std::string_view str, size_t offset) {
+    if (offset >= str.length()) {
+        return str.length();
+    }
+    size_t next = offset + 1;
+    if ((str[offset] & 0xF0) == 0xF0) {         // 4-byte UTF-8
+        next = offset + 4;
+    } else if ((str[offset] & 0xE0) == 0xE0) {  // 3-byte UTF-8
+        next = offset + 3;
+    } else if ((str[offset] & 0xC0) == 0xC0) {  // 2-byte UTF-8
+        next = offset + 2;
+    }
+    while (next < str.length() && (str[next] & 0xC0) == 0x80) {
+        next++;  // Skip stray continuation bytes
+    }
+    return std::min(next, str.length());
+}
+
+/**
+ * @brief Splits and measures screen content
+ * 
+ * Walks the content once, recording each line's offset, length and
+ * visual width. A final line without a line break is kept if non-empty.
+ * @param content The screen text
+ */
+ScreenLayout::ScreenLayout(std::string_view content) : content(content), boxWidth(0) {
+    size_t start = 0;
+    while (start < content.size()) {
+        size_t end = content.find('\n', start);
+        size_t next = end == std::string_view::npos ? content.size() : end + 1;
+        if (end == std::string_view::npos) {
+            end = content.size();
+        }
+
+        size_t length = end - start;
+        if (length > 0 && content[start + length - 1] == '\r') {
+            length--;
+        }
+
+        size_t width = getVisualWidth(content.substr(start, length));
+        lines.push_back({start, length, width});
+        boxWidth = std::max(boxWidth, width);
+        start = next;
+    }
+}
+
+/**
+ * @brief Centers the screen in a terminal of the given size
+ * @param terminalWidth Terminal width in columns
+ * @param terminalHeight Terminal height in rows
+ * @return Placement Position of the first line
+ */
+ScreenLayout::Placement ScreenLayout::Center(int terminalWidth, int terminalHeight) const {
+    // Calculate horizontal and vertical padding
+    int hPadding = (terminalWidth - static_cast<int>(boxWidth)) / 2;
+    int vPadding = (terminalHeight - static_cast<int>(lines.size())) / 2;
+    
+    // Ensure padding values are not negative
+    if (hPadding < 0) hPadding = 0;
+    if (vPadding < 0) vPadding = 0;
+
+    return {hPadding + 1, vPadding + 1};
+}
+
+/**
+ * @brief Gets the text of a line
+ * @param index Line index
+ * @return std::string_view The line without its line break
+ */
+std::string_view ScreenLayout::GetLine(size_t index) const {
+    return content.substr(lines[index].offset, lines[index].length);
+}
+
+/**
+ * @brief Gets the measured lines
+ * @return const std::vector<Line>& All lines in order
+ */
+const std::vector<ScreenLayout::Line>& ScreenLayout::GetLines() const {
+    return lines;
+}
+
+/**
+ * @brief Gets the number of lines
+ * @return size_t Line count
+ */
+size_t ScreenLayout::GetLineCount() const {
+    return lines.size();
+}
+
+/**
+ * @brief Gets the width of the widest line
+ * @return size_t Box width in terminal columns
+ */
+size_t ScreenLayout::GetBoxWidth() const {
+    return boxWidth;
+}
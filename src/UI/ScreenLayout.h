@@ -0,0 +1,111 @@
+/**
+ * @file ScreenLayout.h
+ * @brief Pre-split, pre-measured representation of a UI screen
+ * 
+ * This file defines the ScreenLayout class, which holds the result of
+ * parsing a screen asset once:
+ * - Byte offset and length of every line
+ * - Visual (on-screen) width of every line, UTF-8 aware
+ * - Width of the widest line, used to center the screen
+ * 
+ * Showing a screen from a layout only needs the centering arithmetic
+ * for the current terminal size; the text itself is never re-scanned.
+ * 
+ * @see UI
+ * @see AssetCache
+ */
+
+#pragma once
+#include <string_view>
+#include <vector>
+#include <cstddef>
+
+/**
+ * @brief Calculates the visual width of a string considering UTF-8 characters
+ * @param str The input string to measure
+ * @return size_t The number of terminal columns the string occupies
+ */
+size_t getVisualWidth(std::string_view str);
+
+/**
+ * @brief Finds where the UTF-8 character after the one at an offset starts
+ * 
+ * The length of a character comes from its lead byte; stray continuation
+ * bytes after it are skipped as part of it. These are the rules
+ * getVisualWidth counts columns by, so stepping from offset 0 visits one
+ * offset per column.
+ * @param str The string to step through
+ * @param offset Byte offset of a character
+ * @return size_t Byte offset of the next character, at most str.length()
+ */
+size_t nextCharacterOffset(std::string_view str, size_t offset);
+
+class ScreenLayout {
+public:
+    /**
+     * @brief Position and size of one line inside the screen content
+     */
+    struct Line {
+        size_t offset;       ///< Byte offset of the first character
+        size_t length;       ///< Length in bytes, without the line break
+        size_t visualWidth;  ///< Width in terminal columns
+    };
+
+    /**
+     * @brief Terminal position of the top-left corner of a centered screen
+     */
+    struct Placement {
+        int left;  ///< 1-based terminal column of the first character
+        int top;   ///< 1-based terminal row of the first line
+    };
+
+    /**
+     * @brief Splits and measures screen content
+     * 
+     * The content is not copied, so it must outlive the layout;
+     * AssetCache storage satisfies this. Trailing carriage returns
+     * from CRLF files are dropped from the lines.
+     * @param content The screen text
+     */
+    explicit ScreenLayout(std::string_view content);
+
+    /**
+     * @brief Centers the screen in a terminal of the given size
+     * 
+     * Padding is clamped at zero when the terminal is smaller than the screen.
+     * @param terminalWidth Terminal width in columns
+     * @param terminalHeight Terminal height in rows
+     * @return Placement Position of the first line
+     */
+    Placement Center(int terminalWidth, int terminalHeight) const;
+
+    /**
+     * @brief Gets the text of a line
+     * @param index Line index
+     * @return std::string_view The line without its line break
+     */
+    std::string_view GetLine(size_t index) const;
+
+    /**
+     * @brief Gets the measured lines
+     * @return const std::vector<Line>& All lines in order
+     */
+    const std::vector<Line>& GetLines() const;
+
+    /**
+     * @brief Gets the number of lines
+     * @return size_t Line count
+     */
+    size_t GetLineCount() const;
+
+    /**
+     * @brief Gets the width of the widest line
+     * @return size_t Box width in terminal columns
+     */
+    size_t GetBoxWidth() const;
+
+private:
+    std::string_view content;  ///< Screen text, owned elsewhere
+    std::vector<Line> lines;   ///< Measured lines
+    size_t boxWidth;           ///< Widest visual line width
+};
@@ -2,26 +2,77 @@
  * @file Terminal.cpp
  * @brief Implementation of terminal control and input handling
  * @details Manages terminal display, cursor control, and user input
- *          with support for key callbacks and terminal state management.
+ *          with support for hot key contexts and terminal state management.
  */
 #include "Terminal.h"
+#include "InputSource.h"
 #include <termios.h>
 #include <unistd.h>
 #include <sys/ioctl.h>
+#include <poll.h>
+#include <cerrno>
+#include <charconv>
 #include <iostream>
 #include <string>
 #include <vector>
 #include <mutex>
 #include <memory>
 
+/**
+ * @brief Formats a cursor position escape sequence
+ * 
+ * Writes "\033[y;xH" into the given buffer without going through iostreams.
+ * @param buffer Destination, at least 32 bytes
+ * @param x X coordinate
+ * @param y Y coordinate
+ * @return size_t Number of bytes written
+ */
+static size_t WriteCursorMove(char* buffer, int x, int y) {
+    char* end = buffer + 32;
+    char* p = buffer;
+    *p++ = '\033';
+    *p++ = '[';
+    p = std::to_chars(p, end, y).ptr;
+    *p++ = ';';
+    p = std::to_chars(p, end, x).ptr;
+    *p++ = 'H';
+    return static_cast<size_t>(p - buffer);
+}
+
+/// Escape sequences for the alternate screen and synchronized updates
+static constexpr std::string_view ENTER_ALTERNATE_SCREEN = "\033[?1049h";
+static constexpr std::string_view LEAVE_ALTERNATE_SCREEN = "\033[?1049l";
+static constexpr std::string_view BEGIN_SYNCHRONIZED_UPDATE = "\033[?2026h";
+static constexpr std::string_view END_SYNCHRONIZED_UPDATE = "\033[?2026l";
+static constexpr std::string_view SHOW_CURSOR = "\033[?25h";
+
+/**
+ * @brief Writes all of a buffer to standard output
+ * 
+ * Retries on partial writes and EINTR; gives up on any other error.
+ * @param data Bytes to write
+ * @param size Number of bytes
+ */
+static void WriteAll(const char* data, size_t size) {
+    while (size > 0) {
+        ssize_t written = write(STDOUT_FILENO, data, size);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            break;
+        }
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
+}
+
 /// Static member initialization
 std::unique_ptr<Terminal> Terminal::instance = nullptr;
 std::mutex Terminal::mutex;
-Terminal::KeyCallback Terminal::qKeyCallback = nullptr;
-Terminal::KeyCallback Terminal::hKeyCallback = nullptr;
-Terminal::KeyCallback Terminal::wKeyCallback = nullptr;
-Terminal::KeyCallback Terminal::lKeyCallback = nullptr;
-Terminal::KeyCallback Terminal::pKeyCallback = nullptr;
+std::atomic<unsigned> Terminal::resizeCount{0};
+struct termios Terminal::signalTermios;
+struct sigaction Terminal::oldTerminationActions[TERMINATION_SIGNAL_COUNT];
+bool Terminal::outputIsTerminal = false;
+std::atomic<bool> Terminal::alternateScreenActive{false};
 
 /**
  * @brief Gets the singleton instance
@@ -43,24 +94,163 @@ Terminal& Terminal::GetInstance() {
 /**
  * @brief Constructor
  * 
- * Initializes terminal settings for raw input mode.
+ * Initializes terminal settings for raw input mode and starts tracking
+ * window resizes. SA_RESTART keeps a resize from failing blocking reads.
+ * When standard output is a terminal the game switches to the alternate
+ * screen and, if the terminal supports it, presents every frame as one
+ * synchronized update. Redirected output gets neither.
+ * 
+ * Ctrl-C, SIGTERM and SIGHUP would otherwise skip the destructor and
+ * leave the shell on the alternate screen with echo off, so handlers
+ * for them undo all of this first. Signals that were ignored when the
+ * game started (e.g. SIGINT for a background job) stay ignored.
  */
 Terminal::Terminal() {
     tcgetattr(STDIN_FILENO, &oldt);
     newt = oldt;
     newt.c_lflag &= ~(ICANON | ECHO);
     tcsetattr(STDIN_FILENO, TCSANOW, &newt);
+
+    struct sigaction resizeAction{};
+    resizeAction.sa_handler = HandleResize;
+    sigemptyset(&resizeAction.sa_mask);
+    resizeAction.sa_flags = SA_RESTART;
+    sigaction(SIGWINCH, &resizeAction, &oldResizeAction);
+
+    signalTermios = oldt;
+    outputIsTerminal = isatty(STDOUT_FILENO);
+    struct sigaction terminationAction{};
+    terminationAction.sa_handler = HandleTermination;
+    sigemptyset(&terminationAction.sa_mask);
+    for (size_t i = 0; i < TERMINATION_SIGNAL_COUNT; i++) {
+        sigaddset(&terminationAction.sa_mask, TERMINATION_SIGNALS[i]);
+    }
+    for (size_t i = 0; i < TERMINATION_SIGNAL_COUNT; i++) {
+        sigaction(TERMINATION_SIGNALS[i], nullptr, &oldTerminationActions[i]);
+        if (oldTerminationActions[i].sa_handler != SIG_IGN) {
+            sigaction(TERMINATION_SIGNALS[i], &terminationAction, nullptr);
+        }
+    }
+
+    if (outputIsTerminal) {
+        WriteAll(ENTER_ALTERNATE_SCREEN.data(), ENTER_ALTERNATE_SCREEN.size());
+        alternateScreenActive = true;
+        synchronizedOutput = isatty(STDIN_FILENO) && QuerySynchronizedOutput();
+    }
 }
 
 /**
  * @brief Destructor
  * 
- * Restores original terminal settings.
+ * Returns to the normal screen and restores original terminal settings
+ * and signal handlers.
  */
 Terminal::~Terminal() {
+    LeaveAlternateScreen();
+    sigaction(SIGWINCH, &oldResizeAction, nullptr);
+    for (size_t i = 0; i < TERMINATION_SIGNAL_COUNT; i++) {
+        sigaction(TERMINATION_SIGNALS[i], &oldTerminationActions[i], nullptr);
+    }
     tcsetattr(STDIN_FILENO, TCSANOW, &oldt);
 }
 
+/**
+ * @brief Returns to the normal screen if the alternate one is in use
+ * 
+ * Pending stream output is flushed first so it lands on the alternate
+ * screen it was meant for.
+ */
+void Terminal::LeaveAlternateScreen() {
+    if (alternateScreenActive) {
+        std::cout.flush();
+        WriteAll(LEAVE_ALTERNATE_SCREEN.data(), LEAVE_ALTERNATE_SCREEN.size());
+        alternateScreenActive = false;
+        synchronizedOutput = false;
+    }
+}
+
+/**
+ * @brief Asks the terminal whether it supports synchronized output
+ * 
+ * Sends a DECRQM query for mode 2026 followed by a primary device
+ * attributes request, which every terminal answers. A DECRQM reply
+ * arriving before the attributes reply with a status other than 0 (not
+ * recognized) or 4 (permanently reset) means the mode is supported; a
+ * terminal that ignores DECRQM is detected by the attributes reply
+ * alone, without waiting for the timeout. Must run before anything else
+ * reads standard input. Replies that arrive after the timeout are
+ * dropped by TerminalInput instead of being read as keys.
+ * @return bool True if the terminal supports DEC mode 2026
+ */
+bool Terminal::QuerySynchronizedOutput() {
+    static constexpr std::string_view QUERY = "\033[?2026$p\033[c";
+    WriteAll(QUERY.data(), QUERY.size());
+
+    // Collect replies until the attributes reply ("ESC [ ? ... c") ends;
+    // the DECRQM reply contains no 'c', so the first 'c' after a reply
+    // introducer ends the attributes reply
+    std::string reply;
+    pollfd fd{STDIN_FILENO, POLLIN, 0};
+    while (poll(&fd, 1, QUERY_TIMEOUT_MS) > 0) {
+        char buffer[64];
+        ssize_t count = read(STDIN_FILENO, buffer, sizeof(buffer));
+        if (count <= 0) {
+            break;
+        }
+        reply.append(buffer, static_cast<size_t>(count));
+        size_t replyStart = reply.find("\033[?");
+        if (replyStart != std::string::npos && reply.find('c', replyStart) != std::string::npos) {
+            break;
+        }
+    }
+
+    // Reply format: ESC [ ? 2026 ; Ps $ y
+    size_t status = reply.find("\033[?2026;");
+    if (status == std::string::npos || status + 8 >= reply.size()) {
+        return false;
+    }
+    char mode = reply[status + 8];
+    return mode == '1' || mode == '2' || mode == '3';
+}
+
+/**
+ * @brief SIGWINCH handler
+ * 
+ * Async-signal-safe: only bumps the lock-free resize counter, which
+ * GetTerminalSize compares against the generation it last read at.
+ * @param signal Signal number (unused)
+ */
+void Terminal::HandleResize(int /*signal*/) {
+    resizeCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * @brief SIGINT/SIGTERM/SIGHUP handler
+ * 
+ * Async-signal-safe: shows the cursor and leaves the alternate screen
+ * with write(2), restores the saved termios with tcsetattr, puts back
+ * the previous handler and raises the signal again, which is delivered
+ * once this handler returns and the signal is unblocked.
+ * @param signal Signal number
+ */
+void Terminal::HandleTermination(int signal) {
+    int savedErrno = errno;
+    if (outputIsTerminal) {
+        WriteAll(SHOW_CURSOR.data(), SHOW_CURSOR.size());
+    }
+    if (alternateScreenActive.load(std::memory_order_relaxed)) {
+        WriteAll(LEAVE_ALTERNATE_SCREEN.data(), LEAVE_ALTERNATE_SCREEN.size());
+    }
+    tcsetattr(STDIN_FILENO, TCSANOW, &signalTermios);
+    for (size_t i = 0; i < TERMINATION_SIGNAL_COUNT; i++) {
+        if (TERMINATION_SIGNALS[i] == signal) {
+            sigaction(signal, &oldTerminationActions[i], nullptr);
+        }
+    }
+    errno = savedErrno;
+    raise(signal);
+}
+
 /**
  * @brief Clears the terminal screen
  * 
@@ -78,164 +268,183 @@ void Terminal::Clear() {
  * @param y Y coordinate
  */
 void Terminal::MoveCursor(int x, int y) {
-    std::cout << "\033[" << y << ";" << x << "H";
+    char sequence[32];
+    std::cout.write(sequence, static_cast<std::streamsize>(WriteCursorMove(sequence, x, y)));
 }
 
 /**
- * @brief Hides the terminal cursor
- * 
- * Uses ANSI escape sequence to hide cursor.
+ * @brief Appends a cursor move escape sequence to a string
+ * @param out String to append to
+ * @param x X coordinate
+ * @param y Y coordinate
  */
-void Terminal::HideCursor() {
-    std::cout << "\033[?25l";
+void Terminal::FormatCursorMove(std::string& out, int x, int y) {
+    char sequence[32];
+    out.append(sequence, WriteCursorMove(sequence, x, y));
 }
 
 /**
- * @brief Shows the terminal cursor
- * 
- * Uses ANSI escape sequence to show cursor.
+ * @brief Appends a cursor move to the frame output buffer
+ * @param x X coordinate
+ * @param y Y coordinate
  */
-void Terminal::ShowCursor() {
-    std::cout << "\033[?25h";
+void Terminal::AppendCursorMove(int x, int y) {
+    FormatCursorMove(FrameOutput(), x, y);
 }
 
 /**
- * @brief Sets callback for 'q' key press
- * @param callback Function to call when 'q' is pressed
+ * @brief Appends text to the frame output buffer
+ * @param text Text to append
  */
-void Terminal::SetQKeyCallback(KeyCallback callback) {
-    qKeyCallback = callback;
+void Terminal::AppendText(std::string_view text) {
+    if (!text.empty()) {
+        FrameOutput().append(text.data(), text.size());
+    }
 }
 
 /**
- * @brief Clears 'q' key callback
+ * @brief Appends a color change to the frame output buffer
+ * @param sgrCodes SGR parameters, joined with ';' into one sequence
  */
-void Terminal::ClearQKeyCallback() {
-    qKeyCallback = nullptr;
+void Terminal::AppendColor(std::initializer_list<int> sgrCodes) {
+    FrameOutput() += "\033[";
+    for (const int* code = sgrCodes.begin(); code != sgrCodes.end(); code++) {
+        if (code != sgrCodes.begin()) {
+            outputBuffer += ';';
+        }
+        char digits[12];
+        char* end = std::to_chars(digits, digits + sizeof(digits), *code).ptr;
+        outputBuffer.append(digits, static_cast<size_t>(end - digits));
+    }
+    outputBuffer += 'm';
 }
 
 /**
- * @brief Sets callback for 'h' key press
- * @param callback Function to call when 'h' is pressed
+ * @brief Appends a screen clear to the frame output buffer
  */
-void Terminal::SetHKeyCallback(KeyCallback callback) {
-    hKeyCallback = callback;
+void Terminal::AppendClear() {
+    FrameOutput() += "\033[2J\033[1;1H";
 }
 
 /**
- * @brief Clears 'h' key callback
+ * @brief Gets the frame output buffer for appending
+ * 
+ * The first append of a frame writes the begin update marker when
+ * synchronized output is in use.
+ * @return std::string& The frame output buffer
  */
-void Terminal::ClearHKeyCallback() {
-    hKeyCallback = nullptr;
+std::string& Terminal::FrameOutput() {
+    if (outputBuffer.empty() && synchronizedOutput) {
+        outputBuffer.append(BEGIN_SYNCHRONIZED_UPDATE);
+    }
+    return outputBuffer;
 }
 
 /**
- * @brief Sets callback for 'w' key press
- * @param callback Function to call when 'w' is pressed
+ * @brief Writes the frame output buffer to the terminal
+ * 
+ * Flushes std::cout first so earlier stream output is not overtaken,
+ * then hands the whole buffer to write(2), retrying on partial writes.
+ * A frame opened with the begin update marker is closed with the end
+ * marker, so the terminal shows it all at once instead of painting a
+ * cleared screen first. Output sent through std::cout (Clear,
+ * MoveCursor, HideCursor, ShowCursor) is not part of the frame and is
+ * not synchronized. The buffer keeps its capacity for the next frame.
  */
-void Terminal::SetWKeyCallback(KeyCallback callback) {
-    wKeyCallback = callback;
+void Terminal::Flush() {
+    std::cout.flush();
+    if (outputBuffer.empty()) {
+        return;
+    }
+
+    // Checked on the buffer, as the mode may have been turned off mid-frame
+    if (std::string_view(outputBuffer).substr(0, BEGIN_SYNCHRONIZED_UPDATE.size()) == BEGIN_SYNCHRONIZED_UPDATE) {
+        outputBuffer.append(END_SYNCHRONIZED_UPDATE);
+    }
+    WriteAll(outputBuffer.data(), outputBuffer.size());
+    outputBuffer.clear();
 }
 
 /**
- * @brief Clears 'w' key callback
+ * @brief Hides the terminal cursor
+ * 
+ * Uses ANSI escape sequence to hide cursor.
  */
-void Terminal::ClearWKeyCallback() {
-    wKeyCallback = nullptr;
+void Terminal::HideCursor() {
+    std::cout << "\033[?25l";
 }
 
 /**
- * @brief Sets callback for 'l' key press
- * @param callback Function to call when 'l' is pressed
+ * @brief Shows the terminal cursor
+ * 
+ * Uses ANSI escape sequence to show cursor.
  */
-void Terminal::SetLKeyCallback(KeyCallback callback) {
-    lKeyCallback = callback;
+void Terminal::ShowCursor() {
+    std::cout << SHOW_CURSOR;
 }
 
 /**
- * @brief Clears 'l' key callback
+ * @brief Makes a key map the active hot key context
+ * @param map Bindings to use until PopKeyMap
  */
-void Terminal::ClearLKeyCallback() {
-    lKeyCallback = nullptr;
+void Terminal::PushKeyMap(const KeyMap& map) {
+    keyMaps.push_back(&map);
 }
 
 /**
- * @brief Sets callback for 'p' key press
- * @param callback Function to call when 'p' is pressed
+ * @brief Returns to the previous hot key context
  */
-void Terminal::SetPKeyCallback(KeyCallback callback) {
-    pKeyCallback = callback;
+void Terminal::PopKeyMap() {
+    if (!keyMaps.empty()) {
+        keyMaps.pop_back();
+    }
 }
 
 /**
- * @brief Clears 'p' key callback
+ * @brief Runs the action bound to a key in the innermost context
+ * 
+ * A single table lookup; keys with no binding are ignored.
+ * @param key Key that was read
  */
-void Terminal::ClearPKeyCallback() {
-    pKeyCallback = nullptr;
+void Terminal::DispatchKey(int key) {
+    if (keyMaps.empty()) {
+        return;
+    }
+    if (const KeyMap::Action* action = keyMaps.back()->Find(key)) {
+        (*action)();
+    }
 }
 
 /**
  * @brief Gets a single key press from user
  * 
- * Handles special key callbacks and returns the pressed key.
- * @return int The ASCII value of the pressed key
+ * Reads from the current input source, runs hot key bindings
+ * and returns the pressed key. Escape sequences are decoded, so arrow
+ * keys come back as InputSource::KEY_UP and friends.
+ * @return int The ASCII value of the pressed key, or an InputSource key code
+ * @throws InputClosedException if the input source has no more keys
  */
 int Terminal::GetKeyPress() {
-    int ch = getchar();
-    if (ch == 'q' || ch == 'Q') {
-        if (qKeyCallback) {
-            qKeyCallback();
-        }
-    } else if (ch == 'h' || ch == 'H') {
-        if (hKeyCallback) {
-            hKeyCallback();
-        }
-    } else if (ch == 'w' || ch == 'W') {
-        if (wKeyCallback) {
-            wKeyCallback();
-        }
-    } else if (ch == 'l' || ch == 'L') {
-        if (lKeyCallback) {
-            lKeyCallback();
-        }
-    } else if (ch == 'p' || ch == 'P') {
-        if (pKeyCallback) {
-            pKeyCallback();
-        }
-    }
+    int ch = InputSource::Get().ReadKey();
+    DispatchKey(ch);
     return ch;
 }
 
 /**
  * @brief Gets a yes/no response from user
  * 
- * Waits for and validates Y/N input, handling special key callbacks.
+ * Waits for and validates Y/N input, running hot key bindings.
  * @return char 'Y' or 'N', or 0 for invalid input
  */
 char Terminal::GetYN() {
     ShowCursor();
     char ch;
-    while ((ch = getchar()) != '\n') {
+    while ((ch = InputSource::Get().ReadChar()) != '\n') {
         if (ch == 'y' || ch == 'Y' || ch == 'n' || ch == 'N') {
             std::cout << ch << std::endl;
             return ch;
-        } else if (ch == 'q' || ch == 'Q') {
-            if (qKeyCallback) {
-                qKeyCallback();
-            }
-        } else if (ch == 'h' || ch == 'H') {
-            if (hKeyCallback) {
-                hKeyCallback();
-            }
-        } else if (ch == 'w' || ch == 'W') {
-            if (wKeyCallback) {
-                wKeyCallback();
-            }
-        } else if (ch == 'l' || ch == 'L') {
-            if (lKeyCallback) {
-                lKeyCallback();
-            }
         }
+        DispatchKey(static_cast<unsigned char>(ch));
     }
     HideCursor();
     return 0; // Return 0 for invalid input
@@ -244,7 +453,7 @@ char Terminal::GetYN() {
 /**
  * @brief Gets a line of input from user
  * 
- * Reads input up to specified length, handling special key callbacks.
+ * Reads input up to specified length, running hot key bindings.
  * @param maxLength Maximum length of input
  * @return std::string The input line
  */
@@ -252,24 +461,8 @@ std::string Terminal::GetLine(int maxLength) {
     std::string input;
     char ch;
     
-    while ((ch = getchar()) != '\n') {
-        if (ch == 'q' || ch == 'Q') {
-            if (qKeyCallback) {
-                qKeyCallback();
-            }
-        } else if (ch == 'h' || ch == 'H') {
-            if (hKeyCallback) {
-                hKeyCallback();
-            }
-        } else if (ch == 'w' || ch == 'W') {
-            if (wKeyCallback) {
-                wKeyCallback();
-            }
-        } else if (ch == 'l' || ch == 'L') {
-            if (lKeyCallback) {
-                lKeyCallback();
-            }
-        }
+    while ((ch = InputSource::Get().ReadChar()) != '\n') {
+        DispatchKey(static_cast<unsigned char>(ch));
         if (input.length() < static_cast<size_t>(maxLength)) {
             input += ch;
         }
@@ -280,7 +473,7 @@ std::string Terminal::GetLine(int maxLength) {
 /**
  * @brief Gets an integer input from user
  * 
- * Reads and validates integer input, handling special key callbacks.
+ * Reads and validates integer input, running hot key bindings.
  * @return int The input integer
  */
 int Terminal::GetInteger() {
@@ -289,24 +482,8 @@ int Terminal::GetInteger() {
     int result = 0;
     char ch;
     
-    while ((ch = getchar()) != '\n') {
-        if (ch == 'q' || ch == 'Q') {
-            if (qKeyCallback) {
-                qKeyCallback();
-            }
-        } else if (ch == 'h' || ch == 'H') {
-            if (hKeyCallback) {
-                hKeyCallback();
-            }
-        } else if (ch == 'w' || ch == 'W') {
-            if (wKeyCallback) {
-                wKeyCallback();
-            }
-        } else if (ch == 'l' || ch == 'L') {
-            if (lKeyCallback) {
-                lKeyCallback();
-            }
-        }
+    while ((ch = InputSource::Get().ReadChar()) != '\n') {
+        DispatchKey(static_cast<unsigned char>(ch));
         if (ch >= '0' && ch <= '9') {
             input += ch;
             std::cout << ch;  // Only display digits
@@ -317,30 +494,39 @@ int Terminal::GetInteger() {
     return result;
 }
 
-/**
- * @brief Checks if there is any key press available
- * 
- * Uses non-blocking input check to detect key presses.
- * @return bool True if a key is pressed
- */
-bool Terminal::CheckInput() {
-    int bytesWaiting;
-    ioctl(STDIN_FILENO, FIONREAD, &bytesWaiting);
-    return bytesWaiting > 0;
-}
-
 /**
  * @brief Gets the current terminal size
  * 
- * Retrieves terminal dimensions using ioctl.
+ * Retrieves terminal dimensions using ioctl the first time and after
+ * each resize, and serves the cached size otherwise. When standard
+ * output is not a terminal (e.g. a scripted run redirected to a file) a
+ * default size large enough for the UI box is reported instead.
  * @return TerminalSize containing width and height
  */
 Terminal::TerminalSize Terminal::GetTerminalSize() {
-    TerminalSize size;
+    unsigned generation = GetSizeGeneration();
+    if (sizeKnown && generation == cachedSizeGeneration) {
+        return cachedSize;
+    }
+
+    // Record the generation first, so a resize during the query is
+    // picked up by the next call
+    cachedSizeGeneration = generation;
+    sizeKnown = true;
+    cachedSize = {DEFAULT_WIDTH, DEFAULT_HEIGHT};
     struct winsize w;
-    ioctl(STDOUT_FILENO, TIOCGWINSZ, &w);
-    size.width = w.ws_col;
-    size.height = w.ws_row;
-    return size;
+    if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &w) == 0 && w.ws_col > 0 && w.ws_row > 0) {
+        cachedSize.width = w.ws_col;
+        cachedSize.height = w.ws_row;
+    }
+    return cachedSize;
+}
+
+/**
+ * @brief Gets a number that changes whenever the terminal is resized
+ * @return unsigned Current size generation
+ */
+unsigned Terminal::GetSizeGeneration() const {
+    return resizeCount.load(std::memory_order_relaxed);
 }
 
@@ -4,22 +4,31 @@
  * 
  * This file defines the Terminal class, which provides functionality for:
  * - Terminal display control (clear, cursor movement)
- * - User input handling
+ * - Buffered frame output written with a single system call, wrapped in
+ *   synchronized-update markers when the terminal supports them
+ * - The alternate screen, so the game leaves the shell's screen intact
+ * - User input handling, read from the current InputSource
  * - Terminal state management
- * - Key callback registration
- * - Terminal size management
+ * - Hot key dispatch through a stack of KeyMap contexts
+ * - Terminal size, cached and refreshed when SIGWINCH reports a resize
  * 
  * The Terminal class implements the Singleton pattern to ensure
  * consistent terminal state management across the application.
  * 
  * @see UI
  * @see Animation
+ * @see InputSource
  */
 
 #pragma once
+#include "KeyMap.h"
+#include <initializer_list>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <termios.h>
+#include <signal.h>
+#include <atomic>
 #include <mutex>
 #include <memory>
 
@@ -30,15 +39,37 @@ private:
 
     /// Terminal state variables
     struct termios oldt, newt;                 ///< Terminal settings
+    struct sigaction oldResizeAction;          ///< SIGWINCH handler to restore
     std::string defaultColor = "\033[0m";      ///< Default terminal color
+    std::string outputBuffer;                  ///< Pending frame output
+    bool synchronizedOutput = false;           ///< Whether frames are wrapped in DEC mode 2026
+
+    /// Longest wait for the terminal to answer the startup capability query
+    static constexpr int QUERY_TIMEOUT_MS = 200;
+
+    /// Size reported when standard output is not a terminal
+    static constexpr int DEFAULT_WIDTH = 130;
+    static constexpr int DEFAULT_HEIGHT = 45;
     
-    /// Key callback function type
-    using KeyCallback = void(*)();
-    static KeyCallback qKeyCallback;           ///< Callback for 'q' key
-    static KeyCallback hKeyCallback;           ///< Callback for 'h' key
-    static KeyCallback wKeyCallback;           ///< Callback for 'w' key
-    static KeyCallback lKeyCallback;           ///< Callback for 'l' key
-    static KeyCallback pKeyCallback;           ///< Callback for 'p' key
+    /// SIGWINCH signals received; bumped from the signal handler
+    static std::atomic<unsigned> resizeCount;
+    static_assert(std::atomic<unsigned>::is_always_lock_free,
+                  "resizeCount is updated from a signal handler");
+
+    /// Signals that end the game and must leave the terminal usable
+    static constexpr int TERMINATION_SIGNALS[] = {SIGINT, SIGTERM, SIGHUP};
+    static constexpr size_t TERMINATION_SIGNAL_COUNT = sizeof(TERMINATION_SIGNALS) / sizeof(int);
+
+    /// State read by the termination handler, set before it is installed
+    static struct termios signalTermios;                                  ///< Settings to restore
+    static struct sigaction oldTerminationActions[TERMINATION_SIGNAL_COUNT]; ///< Handlers to restore
+    static bool outputIsTerminal;                                         ///< Whether the cursor was hidden on a terminal
+    static std::atomic<bool> alternateScreenActive;                       ///< Whether to leave the alternate screen
+    static_assert(std::atomic<bool>::is_always_lock_free,
+                  "alternateScreenActive is read from a signal handler");
+
+    /// Hot key contexts, innermost last; only the innermost is consulted
+    std::vector<const KeyMap*> keyMaps;
 
     /**
      * @brief Private constructor for singleton pattern
@@ -66,71 +97,85 @@ public:
     static Terminal& GetInstance();
     
     /**
-     * @brief Sets callback for 'q' key press
-     * @param callback Function to call when 'q' is pressed
+     * @brief Makes a key map the active hot key context
+     * 
+     * The map shadows any context pushed before it until it is popped.
+     * @param map Bindings to use, which must outlive the push
      */
-    static void SetQKeyCallback(KeyCallback callback);
+    void PushKeyMap(const KeyMap& map);
     
     /**
-     * @brief Clears 'q' key callback
+     * @brief Returns to the hot key context active before the last push
      */
-    static void ClearQKeyCallback();
+    void PopKeyMap();
     
     /**
-     * @brief Sets callback for 'h' key press
-     * @param callback Function to call when 'h' is pressed
+     * @brief Returns to the normal screen if the alternate one is in use
+     * 
+     * Called by the destructor; call it earlier to print a message that
+     * should stay on screen after the game exits.
      */
-    static void SetHKeyCallback(KeyCallback callback);
+    void LeaveAlternateScreen();
     
     /**
-     * @brief Clears 'h' key callback
+     * @brief Clears the terminal screen
      */
-    static void ClearHKeyCallback();
-    
+    void Clear();
+
     /**
-     * @brief Sets callback for 'w' key press
-     * @param callback Function to call when 'w' is pressed
+     * @brief Moves cursor to specified position
+     * @param x X coordinate
+     * @param y Y coordinate
      */
-    static void SetWKeyCallback(KeyCallback callback);
-    
+    void MoveCursor(int x, int y);
+
     /**
-     * @brief Clears 'w' key callback
+     * @brief Appends a cursor move escape sequence to a string
+     * 
+     * Used to pre-render output that is sent later with AppendText.
+     * @param out String to append to
+     * @param x X coordinate
+     * @param y Y coordinate
      */
-    static void ClearWKeyCallback();
-    
+    static void FormatCursorMove(std::string& out, int x, int y);
+
     /**
-     * @brief Sets callback for 'l' key press
-     * @param callback Function to call when 'l' is pressed
+     * @brief Appends a cursor move to the frame output buffer
+     * @param x X coordinate
+     * @param y Y coordinate
      */
-    static void SetLKeyCallback(KeyCallback callback);
-    
+    void AppendCursorMove(int x, int y);
+
     /**
-     * @brief Clears 'l' key callback
+     * @brief Appends text to the frame output buffer
+     * @param text Text to append
      */
-    static void ClearLKeyCallback();
-    
+    void AppendText(std::string_view text);
+
     /**
-     * @brief Sets callback for 'p' key press
-     * @param callback Function to call when 'p' is pressed
+     * @brief Appends a color change to the frame output buffer
+     *
+     * All parameters go out in one SGR sequence, so a reset and a new
+     * foreground and background cost a single escape.
+     * @param sgrCodes SGR parameters (e.g. 31 for red, 44 for a blue
+     *        background, 0 to reset)
      */
-    static void SetPKeyCallback(KeyCallback callback);
-    
+    void AppendColor(std::initializer_list<int> sgrCodes);
+
     /**
-     * @brief Clears 'p' key callback
+     * @brief Appends a screen clear to the frame output buffer
      */
-    static void ClearPKeyCallback();
-    
-    /**
-     * @brief Clears the terminal screen
-     */
-    void Clear();
+    void AppendClear();
 
     /**
-     * @brief Moves cursor to specified position
-     * @param x X coordinate
-     * @param y Y coordinate
+     * @brief Writes the frame output buffer to the terminal
+     *
+     * Anything already queued on std::cout is flushed first so output
+     * stays in order; the buffer itself goes out in one write(2). Only
+     * the buffer is synchronized: Clear, MoveCursor, HideCursor and
+     * ShowCursor write to std::cout and take effect outside the frame.
      */
-    void MoveCursor(int x, int y);
+    void Flush();
 
     /**
      * @brief Hides the terminal cursor
@@ -144,7 +189,8 @@ public:
     
     /**
      * @brief Gets a single key press from user
-     * @return int The ASCII value of the pressed key
+     * @return int The ASCII value of the pressed key, or an InputSource
+     *         key code such as InputSource::KEY_LEFT for special keys
      */
     int GetKeyPress();
 
@@ -167,12 +213,6 @@ public:
      */
     int GetInteger();
 
-    /**
-     * @brief Checks if there is any key press available
-     * @return bool True if a key is pressed
-     */
-    bool CheckInput();
-    
     /**
      * @brief Structure containing terminal dimensions
      */
@@ -183,7 +223,60 @@ public:
 
     /**
      * @brief Gets the current terminal size
+     * 
+     * Cached; the terminal is only queried again after a resize.
      * @return TerminalSize containing width and height
      */
     TerminalSize GetTerminalSize();
+
+    /**
+     * @brief Gets a number that changes whenever the terminal is resized
+     * 
+     * Screens that place themselves from the terminal size keep the
+     * generation they were laid out for and redo their layout when it
+     * no longer matches.
+     * @return unsigned Current size generation
+     */
+    unsigned GetSizeGeneration() const;
+
+private:
+    TerminalSize cachedSize{DEFAULT_WIDTH, DEFAULT_HEIGHT}; ///< Size as of cachedSizeGeneration
+    unsigned cachedSizeGeneration = 0;                      ///< Generation cachedSize was read at
+    bool sizeKnown = false;                                 ///< Whether cachedSize was read at all
+
+    /**
+     * @brief Asks the terminal whether it supports synchronized output
+     * @return bool True if it reported DEC mode 2026 as known
+     */
+    static bool QuerySynchronizedOutput();
+
+    /**
+     * @brief Gets the frame output buffer for appending
+     *
+     * Starts a new frame with the begin update marker when synchronized
+     * output is in use, so Flush only has to close it.
+     * @return std::string& The frame output buffer
+     */
+    std::string& FrameOutput();
+
+    /**
+     * @brief SIGWINCH handler; only bumps resizeCount
+     * @param signal Signal number
+     */
+    static void HandleResize(int signal);
+
+    /**
+     * @brief SIGINT/SIGTERM/SIGHUP handler
+     * 
+     * Restores the screen, cursor and terminal settings, then re-raises
+     * the signal with the handler that was installed before the game's.
+     * @param signal Signal number
+     */
+    static void HandleTermination(int signal);
+
+    /**
+     * @brief Runs the action bound to a key in the innermost context
+     * @param key Key that was read
+     */
+    void DispatchKey(int key);
 };
\ No newline at end of file
@@ -7,142 +7,74 @@
 #include "UI.h"
 #include "Terminal.h"
 #include "Animation.h"
+#include "AssetCache.h"
+#include "ScreenLayout.h"
+#include "InputSource.h"
 #include <iostream>
 #include <string>
 #include <vector>
-#include <fstream>
-#include <sstream>
 #include "../Core/WeekCycle.h"
-#include <thread>
 #include <chrono>
 
-/**
- * @brief Calculates the visual width of a string considering UTF-8 characters
- * 
- * Handles multi-byte UTF-8 characters correctly when calculating display width.
- * @param str The input string to measure
- * @return size_t The visual width of the string
- */
-size_t getVisualWidth(const std::string& str) {
-    size_t width = 0;
-    for (size_t i = 0; i < str.length();) {
-        if ((str[i] & 0xC0) != 0x80) {  // Start of a new character
-            if ((str[i] & 0xF0) == 0xF0) {  // 4-byte UTF-8
-                i += 4;
-                width += 1;
-            } else if ((str[i] & 0xE0) == 0xE0) {  // 3-byte UTF-8
-                i += 3;
-                width += 1;
-            } else if ((str[i] & 0xC0) == 0xC0) {  // 2-byte UTF-8
-                i += 2;
-                width += 1;
-            } else {  // 1-byte character
-                i += 1;
-                width += 1;
-            }
-        } else {
-            i += 1;  // Skip continuation byte
-        }
-    }
-    return width;
-}
-
 /**
  * @brief Loads UI content from a file
  * 
- * Reads the entire contents of a UI file into a string.
+ * Returns a copy of the file contents held by the asset cache,
+ * so the file is only read from disk the first time.
  * @param filename Path to the UI file
  * @return std::string The file contents
  * @throw std::runtime_error if file cannot be opened
  */
 std::string UI::LoadUI(const std::string& filename) {
-    std::ifstream file(filename);
-    if (!file.is_open()) {
-        throw std::runtime_error("Failed to open UI file: " + filename);
-    }
-
-    std::stringstream buffer;
-    buffer << file.rdbuf();
-    return buffer.str();
+    return std::string(AssetCache::GetInstance().Get(filename));
 }
 
 /**
  * @brief Displays UI content with proper centering
  * 
- * Centers the content both horizontally and vertically in the terminal,
- * handling UTF-8 characters correctly.
- * @param content The content to display
+ * Centers the content both horizontally and vertically in the terminal.
+ * Lines and their UTF-8 widths come pre-measured from the layout, so
+ * only the padding has to be worked out for the current terminal size.
+ * @param layout The layout to display
  */
-void UI::DisplayUI(const std::string& content) {
+void UI::DisplayUI(const ScreenLayout& layout) {
     auto& terminal = Terminal::GetInstance();
     auto size = terminal.GetTerminalSize();
-    std::vector<std::string> lines;
-    size_t boxWidth = 0;
-    size_t pos;
-    std::string temp = content;
-    
-    // Split content into lines
-    while ((pos = temp.find('\n')) != std::string::npos) {
-        std::string line = temp.substr(0, pos);
-        boxWidth = std::max(boxWidth, getVisualWidth(line));
-        lines.push_back(line);
-        temp.erase(0, pos + 1);
-    }
-    if (!temp.empty()) {
-        boxWidth = std::max(boxWidth, getVisualWidth(temp));
-        lines.push_back(temp);
-    }
-    
-    // Calculate horizontal and vertical padding
-    int hPadding = (size.width - boxWidth) / 2;
-    int vPadding = (size.height - lines.size()) / 2;
-    
-    // Ensure padding values are not negative
-    if (hPadding < 0) hPadding = 0;
-    if (vPadding < 0) vPadding = 0;
     
-    // Clear screen and move cursor to start position
-    terminal.Clear();
-    terminal.MoveCursor(1, 1);
+    auto placement = layout.Center(size.width, size.height);
     
-    // Display content
-    for (int i = 0; i < vPadding; i++) {
-        std::cout << std::endl;
-    }
-    for (const auto& line : lines) {
-        // Use safe string creation method
-        if (hPadding > 0) {
-            std::cout << std::string(static_cast<size_t>(hPadding), ' ');
-        }
-        std::cout << line << std::endl;
-    }
-    for (int i = 0; i < vPadding - 1; i++) {
-        std::cout << std::endl;
+    // Clear screen and place each line at its centered position, all in
+    // one buffered write
+    terminal.AppendClear();
+    for (size_t i = 0; i < layout.GetLineCount(); i++) {
+        terminal.AppendCursorMove(placement.left, placement.top + static_cast<int>(i));
+        terminal.AppendText(layout.GetLine(i));
     }
     
     // Ensure cursor is on the last line
-    terminal.MoveCursor(1, size.height);
+    terminal.AppendCursorMove(1, size.height);
+    terminal.Flush();
 }
 
 /**
  * @brief Displays UI content from a file
  * 
- * Loads and displays the contents of a UI file.
+ * Displays the cached layout of a UI file, which is split and
+ * measured only the first time the file is shown.
  * @param filename Path to the UI file
  */
 void UI::DisplayUIFromFile(const std::string& filename) {
-    std::string content = LoadUI(filename);
-    DisplayUI(content);
+    DisplayUI(AssetCache::GetInstance().GetLayout(filename));
 }
 
 /**
  * @brief Shows a UI interface from a file
  * 
  * Clears the screen and displays the specified UI file.
+ * The clear is part of the same buffered frame as the content.
  * @param filename Path to the UI file
  */
 void UI::ShowInterface(const std::string& filename) {
-    Terminal::GetInstance().Clear();
     DisplayUIFromFile(filename);
 }
 
@@ -164,21 +96,13 @@ void UI::WaitForEnter(const std::string& message) {
     MoveCursorInBox(x, y);
     std::cout << message;
     
-    // Completely clear the input buffer and ignore any previous input
-    std::cin.clear();
-    while (std::cin.rdbuf()->in_avail()) {
-        std::cin.ignore();
-    }
+    // Ignore anything typed before the prompt appeared
+    auto& input = InputSource::Get();
+    input.DiscardPending();
     
-    // Wait for a new Enter key press
-    char c;
-    do {
-        c = std::cin.get();
-        // If we get any character other than Enter, ignore it
-        if (c != '\n') {
-            std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-        }
-    } while (c != '\n');
+    // Wait for a new Enter key press, ignoring any other keys
+    while (input.ReadChar() != '\n') {
+    }
 }
 
 /**
@@ -192,32 +116,29 @@ void UI::WaitForEnter(const std::string& message) {
 void UI::ShowDayTransition(std::string dayName, int currentWeek) {
     ShowInterface("ui/empty.txt");
     Animation::TypewriterInBox("Congratulations! You survived one more day!", 50, 13);
-    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    Animation::Pause(std::chrono::milliseconds(500));
 
     Animation::TypewriterInBox("Now, let's start a new day!", 50, 15);
-    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    Animation::Pause(std::chrono::milliseconds(500));
 
     Animation::TypewriterInBox("Today is ......", 50, 17);
-    std::this_thread::sleep_for(std::chrono::milliseconds(1500));
+    Animation::Pause(std::chrono::milliseconds(1500));
 
     std::string filename = dayName + std::to_string(currentWeek) + ".txt";
     ShowInterface("ui/Days/" + filename);
 
-    std::this_thread::sleep_for(std::chrono::seconds(2));
+    Animation::Pause(std::chrono::seconds(2));
     WaitForEnter("Press Enter to continue...");
 }
 
 /**
- * @brief Moves cursor to position within UI box
- * 
- * Positions the cursor at specified coordinates relative to
- * the UI box boundaries.
+ * @brief Gets the terminal position of coordinates within the UI box
  * @param x X coordinate within the box
  * @param y Y coordinate within the box
+ * @return UI::CursorPosition Terminal position of the point
  */
-void UI::MoveCursorInBox(int x, int y) {
-    auto& terminal = Terminal::GetInstance();
-    auto size = terminal.GetTerminalSize();
+UI::CursorPosition UI::GetBoxPosition(int x, int y) {
+    auto size = Terminal::GetInstance().GetTerminalSize();
     
     // Calculate box position in terminal
     int hPadding = (size.width - BOX_WIDTH) / 2;
@@ -232,30 +153,52 @@ void UI::MoveCursorInBox(int x, int y) {
     int actualX = hPadding + x + 2;  // Start from 2 instead of 1
     int actualY = vPadding + y + 2;  // Start from 2 instead of 1
     
-    // Move cursor
-    terminal.MoveCursor(actualX, actualY);
+    return {actualX, actualY};
 }
 
 /**
- * @brief Centers cursor for text display
- * 
- * Moves the cursor to center a text string within the UI box.
+ * @brief Gets the terminal position that centers text on a box line
  * @param text The text to center
  * @param lineNumber The line number to center the text on
+ * @return UI::CursorPosition Terminal position of the first character
  */
-void UI::MoveCursorToCenter(const std::string& text, int lineNumber) {
+UI::CursorPosition UI::GetCenterPosition(const std::string& text, int lineNumber) {
     // Calculate the width of the box (excluding borders)
     int boxContentWidth = BOX_WIDTH - 4;  // -4 for borders (2 on each side)
     
     // Calculate horizontal padding to center the text
-    int hPadding = (boxContentWidth - getVisualWidth(text)) / 2;
+    int hPadding = (boxContentWidth - static_cast<int>(getVisualWidth(text))) / 2;
     
     // Calculate the vertical position
     // lineNumber is 1-based, and we need to account for the top border
     int y = lineNumber + 1;  // +1 to account for the top border
     
-    // Move cursor to the calculated position
-    MoveCursorInBox(hPadding, y);
+    return GetBoxPosition(hPadding, y);
+}
+
+/**
+ * @brief Moves cursor to position within UI box
+ * 
+ * Positions the cursor at specified coordinates relative to
+ * the UI box boundaries.
+ * @param x X coordinate within the box
+ * @param y Y coordinate within the box
+ */
+void UI::MoveCursorInBox(int x, int y) {
+    auto position = GetBoxPosition(x, y);
+    Terminal::GetInstance().MoveCursor(position.x, position.y);
+}
+
+/**
+ * @brief Centers cursor for text display
+ * 
+ * Moves the cursor to center a text string within the UI box.
+ * @param text The text to center
+ * @param lineNumber The line number to center the text on
+ */
+void UI::MoveCursorToCenter(const std::string& text, int lineNumber) {
+    auto position = GetCenterPosition(text, lineNumber);
+    Terminal::GetInstance().MoveCursor(position.x, position.y);
 }
 
 /**
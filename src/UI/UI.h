@@ -8,7 +8,7 @@
  * - Text positioning and formatting
  * - User input prompts
  * - Box-based UI layout management
- * - File-based UI content loading
+ * - File-based UI content loading (served from AssetCache)
  * 
  * The UI class provides a consistent interface for displaying game content
  * within a boxed layout, with support for centered text, cursor positioning,
@@ -22,6 +22,8 @@
 #pragma once
 #include <string>
 
+class ScreenLayout;
+
 class UI {
 public:
     /**
@@ -56,6 +58,33 @@ public:
      */
     static void MoveCursorInBox(int x, int y);
 
+    /**
+     * @brief Terminal position of a point inside the UI box
+     */
+    struct CursorPosition {
+        int x;  ///< 1-based terminal column
+        int y;  ///< 1-based terminal row
+    };
+
+    /**
+     * @brief Gets the terminal position of coordinates within the UI box
+     * 
+     * Same arithmetic as MoveCursorInBox, for callers that buffer
+     * their cursor moves instead of writing them at once.
+     * @param x X coordinate within the box
+     * @param y Y coordinate within the box
+     * @return CursorPosition Terminal position of the point
+     */
+    static CursorPosition GetBoxPosition(int x, int y);
+
+    /**
+     * @brief Gets the terminal position that centers text on a box line
+     * @param text The text to center
+     * @param lineNumber The line number to center the text on
+     * @return CursorPosition Terminal position of the first character
+     */
+    static CursorPosition GetCenterPosition(const std::string& text, int lineNumber);
+
     /**
      * @brief Waits for user to press Enter
      * 
@@ -113,11 +142,11 @@ private:
     /**
      * @brief Displays UI content
      * 
-     * Internal function to display UI content string.
-     * @param content The content to display
+     * Internal function to display a pre-measured screen layout.
+     * @param layout The layout to display
      * @return void
      */
-    static void DisplayUI(const std::string& content);
+    static void DisplayUI(const ScreenLayout& layout);
 
     /**
      * @brief Displays UI content from file
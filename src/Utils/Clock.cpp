@@ -0,0 +1,64 @@
+/**
+ * @file Clock.cpp
+ * @brief Implementation of the real and virtual clocks
+ * @details Holds the process-wide current clock, which defaults to
+ *          the steady wall clock.
+ */
+#include "Clock.h"
+#include <thread>
+
+/// Clock used when none has been set
+static RealClock realClock;
+
+/// Clock the game currently runs on
+static Clock* currentClock = &realClock;
+
+/**
+ * @brief Gets the clock the game currently runs on
+ * @return Clock& The current clock
+ */
+Clock& Clock::Get() {
+    return *currentClock;
+}
+
+/**
+ * @brief Replaces the clock the game runs on
+ * @param clock New clock, or nullptr for the real clock
+ */
+void Clock::Set(Clock* clock) {
+    currentClock = clock ? clock : &realClock;
+}
+
+/**
+ * @brief Gets the current steady clock time
+ * @return TimePoint Current time
+ */
+Clock::TimePoint RealClock::Now() const {
+    return std::chrono::steady_clock::now();
+}
+
+/**
+ * @brief Sleeps the calling thread until the deadline
+ * @param deadline Time to wake up at
+ */
+void RealClock::SleepUntil(TimePoint deadline) {
+    std::this_thread::sleep_until(deadline);
+}
+
+/**
+ * @brief Gets the current simulated time
+ * @return TimePoint Current time
+ */
+Clock::TimePoint VirtualClock::Now() const {
+    return current;
+}
+
+/**
+ * @brief Jumps the simulated time forward to the deadline
+ * @param deadline Time to advance to; earlier deadlines leave the time unchanged
+ */
+void VirtualClock::SleepUntil(TimePoint deadline) {
+    if (deadline > current) {
+        current = deadline;
+    }
+}
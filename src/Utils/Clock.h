@@ -0,0 +1,89 @@
+/**
+ * @file Clock.h
+ * @brief Time source used for every delay and deadline in the game
+ *
+ * This file defines the Clock interface and its two implementations:
+ * - RealClock: the steady wall clock, sleeping the calling thread
+ * - VirtualClock: simulated time that jumps forward instead of sleeping
+ *
+ * Game code never sleeps directly; it asks Clock::Get() for the time and
+ * to wait, so a scripted run can swap in a VirtualClock and play through
+ * every typewriter effect, animation and combat wave without waiting.
+ *
+ * @see InputSource
+ */
+
+#pragma once
+#include <chrono>
+
+/**
+ * @class Clock
+ * @brief Abstract time source with a process-wide current instance
+ */
+class Clock {
+public:
+    using TimePoint = std::chrono::steady_clock::time_point;  ///< Point in time
+    using Duration = std::chrono::steady_clock::duration;     ///< Span of time
+
+    virtual ~Clock() = default;
+
+    /**
+     * @brief Gets the current time
+     * @return TimePoint Current time of this clock
+     */
+    virtual TimePoint Now() const = 0;
+
+    /**
+     * @brief Waits until the given time
+     * @param deadline Time to wait for; returns at once if already passed
+     */
+    virtual void SleepUntil(TimePoint deadline) = 0;
+
+    /**
+     * @brief Waits for the given duration
+     * @param duration Time to wait
+     */
+    void SleepFor(Duration duration) {
+        SleepUntil(Now() + duration);
+    }
+
+    /**
+     * @brief Gets the clock the game currently runs on
+     * @return Clock& The current clock, a RealClock unless Set was called
+     */
+    static Clock& Get();
+
+    /**
+     * @brief Replaces the clock the game runs on
+     *
+     * Meant to be called once at startup, before any other thread runs.
+     * @param clock New clock, owned by the caller; nullptr restores the real clock
+     */
+    static void Set(Clock* clock);
+};
+
+/**
+ * @class RealClock
+ * @brief Wall-clock time from std::chrono::steady_clock
+ */
+class RealClock : public Clock {
+public:
+    TimePoint Now() const override;
+    void SleepUntil(TimePoint deadline) override;
+};
+
+/**
+ * @class VirtualClock
+ * @brief Simulated time that only moves when someone waits
+ *
+ * Sleeping advances the clock to the deadline and returns immediately,
+ * so timing logic behaves as in real time but costs nothing.
+ */
+class VirtualClock : public Clock {
+public:
+    TimePoint Now() const override;
+    void SleepUntil(TimePoint deadline) override;
+
+private:
+    TimePoint current{};  ///< Current simulated time
+};
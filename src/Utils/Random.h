@@ -1,65 +1,197 @@
 #pragma once
+#include <array>
+#include <cstdint>
+#include <limits>
 #include <random> // C++11 random number library
 
 /**
  * @brief Random number generation system
- * 
- * This namespace provides a thread-safe random number generation system
+ *
+ * This namespace provides a seedable random number generation system
  * with various utility functions for generating random numbers and
- * probability-based decisions. It uses C++11's random number facilities
- * with a thread-local random number generator to ensure thread safety.
+ * probability-based decisions. Draws come from independent named streams
+ * (zombie spawns, exploration outcomes, loot amounts), so consuming more
+ * numbers in one part of the game does not shift the results of another.
+ * Every thread owns its own set of streams, seeded from std::random_device
+ * until Seed() is called; a seeded run is fully reproducible.
  */
 namespace Random {
     /**
-     * @brief Thread-local random number generator
-     * 
-     * Each thread gets its own instance of the random number generator
-     * to ensure thread safety and prevent contention between threads.
+     * @brief xoshiro256** pseudo-random number generator
+     *
+     * A small, fast generator with a 256-bit state, usable anywhere a
+     * standard UniformRandomBitGenerator is expected.
      */
-    static thread_local std::mt19937 generator(std::random_device{}());
-    
+    class Xoshiro256 {
+    public:
+        using result_type = uint64_t;
+
+        /**
+         * @brief Constructs a generator from a 64-bit seed
+         * @param seed Seed value; equal seeds give equal sequences
+         */
+        explicit Xoshiro256(uint64_t seed = 0) {
+            Seed(seed);
+        }
+
+        /**
+         * @brief Resets the state from a 64-bit seed
+         *
+         * Expands the seed with splitmix64, which never yields the
+         * all-zero state xoshiro cannot leave.
+         * @param seed Seed value
+         */
+        void Seed(uint64_t seed) {
+            for (auto& word : state) {
+                seed += 0x9E3779B97F4A7C15ull;
+                uint64_t z = seed;
+                z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+                z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+                word = z ^ (z >> 31);
+            }
+        }
+
+        /**
+         * @brief Generates the next 64 random bits
+         * @return result_type Uniformly distributed value
+         */
+        result_type operator()() {
+            const uint64_t result = RotateLeft(state[1] * 5, 7) * 9;
+            const uint64_t t = state[1] << 17;
+            state[2] ^= state[0];
+            state[3] ^= state[1];
+            state[1] ^= state[2];
+            state[0] ^= state[3];
+            state[2] ^= t;
+            state[3] = RotateLeft(state[3], 45);
+            return result;
+        }
+
+        static constexpr result_type min() { return 0; }
+        static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    private:
+        std::array<uint64_t, 4> state;
+
+        static uint64_t RotateLeft(uint64_t x, int k) {
+            return (x << k) | (x >> (64 - k));
+        }
+    };
+
+    /**
+     * @brief Independent random number streams
+     */
+    enum class Stream {
+        DEFAULT,    ///< Anything without a stream of its own
+        SPAWN,      ///< Zombie spawn decisions and positions
+        EXPLORE,    ///< Exploration outcomes
+        LOOT,       ///< Amounts of gold, crops and people found
+        COUNT       ///< Number of streams
+    };
+
+    /**
+     * @brief Gets a generator stream of the calling thread
+     *
+     * Each thread gets its own instance of the streams to ensure thread
+     * safety and prevent contention between threads.
+     * @param stream Stream to get
+     * @return Xoshiro256& The stream's generator
+     */
+    inline Xoshiro256& GetStream(Stream stream = Stream::DEFAULT) {
+        thread_local std::array<Xoshiro256, static_cast<size_t>(Stream::COUNT)> streams = [] {
+            std::array<Xoshiro256, static_cast<size_t>(Stream::COUNT)> seeded;
+            std::random_device device;
+            uint64_t seed = (static_cast<uint64_t>(device()) << 32) | device();
+            for (size_t i = 0; i < seeded.size(); i++) {
+                seeded[i].Seed(seed ^ (i * 0xD1B54A32D192ED03ull));
+            }
+            return seeded;
+        }();
+        return streams[static_cast<size_t>(stream)];
+    }
+
+    /**
+     * @brief Seeds every stream of the calling thread
+     *
+     * Each stream gets its own sequence derived from the one seed.
+     * @param seed Seed value
+     */
+    inline void Seed(uint64_t seed) {
+        for (size_t i = 0; i < static_cast<size_t>(Stream::COUNT); i++) {
+            GetStream(static_cast<Stream>(i)).Seed(seed ^ (i * 0xD1B54A32D192ED03ull));
+        }
+    }
+
+    /**
+     * @brief Returns a uniformly distributed double in [0, 1)
+     * @param stream Stream to draw from
+     * @return double Random value with 53 bits of precision
+     */
+    inline double Unit(Stream stream = Stream::DEFAULT) {
+        return static_cast<double>(GetStream(stream)() >> 11) * 0x1.0p-53;
+    }
+
     /**
      * @brief Generate a random integer within a specified range
      * @tparam T The integer type (e.g., int, long)
      * @param min The minimum value (inclusive)
      * @param max The maximum value (inclusive)
+     * @param stream Stream to draw from
      * @return A random integer between min and max
-     * 
+     *
      * Generates a random integer value within the specified range [min, max].
-     * The range is inclusive of both min and max values.
+     * The range is inclusive of both min and max values. Ranges of up to
+     * 2^32 values use Lemire's multiply-shift method with no division on
+     * the common path; wider ranges fall back to the standard distribution.
      */
     template<typename T>
-    T Range(T min, T max) {
-        std::uniform_int_distribution<T> dist(min, max);
-        return dist(generator);
+    T Range(T min, T max, Stream stream = Stream::DEFAULT) {
+        auto& generator = GetStream(stream);
+        uint64_t span = static_cast<uint64_t>(max) - static_cast<uint64_t>(min) + 1;
+        if (span == 0 || span > 0xFFFFFFFFull) {
+            std::uniform_int_distribution<T> dist(min, max);
+            return dist(generator);
+        }
+
+        uint64_t product = (generator() >> 32) * span;
+        uint32_t low = static_cast<uint32_t>(product);
+        if (low < span) {
+            uint32_t threshold = static_cast<uint32_t>((0x100000000ull - span) % span);
+            while (low < threshold) {
+                product = (generator() >> 32) * span;
+                low = static_cast<uint32_t>(product);
+            }
+        }
+        return static_cast<T>(static_cast<uint64_t>(min) + (product >> 32));
     }
-    
+
     /**
      * @brief Generate a random floating-point number within a specified range
      * @tparam T The floating-point type (e.g., float, double)
      * @param min The minimum value (inclusive)
      * @param max The maximum value (exclusive)
+     * @param stream Stream to draw from
      * @return A random floating-point number between min and max
-     * 
+     *
      * Generates a random floating-point value within the specified range [min, max).
      * The range is inclusive of min but exclusive of max.
      */
     template<typename T>
-    T RangeReal(T min, T max) {
-        std::uniform_real_distribution<T> dist(min, max);
-        return dist(generator);
+    T RangeReal(T min, T max, Stream stream = Stream::DEFAULT) {
+        T value = min + static_cast<T>(Unit(stream) * (static_cast<double>(max) - min));
+        return value < max ? value : min;
     }
-    
+
     /**
      * @brief Perform a probability-based decision
      * @param probability The probability of returning true (0.0 to 1.0)
+     * @param stream Stream to draw from
      * @return true with the specified probability, false otherwise
-     * 
+     *
      * Makes a random decision based on the given probability.
      * For example, Chance(0.3) has a 30% chance of returning true.
      */
-    inline bool Chance(float probability) {
-        std::bernoulli_distribution dist(probability);
-        return dist(generator);
+    inline bool Chance(float probability, Stream stream = Stream::DEFAULT) {
+        return Unit(stream) < probability;
     }
-}
\ No newline at end of file
+}
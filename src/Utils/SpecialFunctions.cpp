@@ -11,8 +11,9 @@
 #include "../Core/WeekCycle.h"
 #include "../Combat/Weapon.h"
 #include "../UI/Terminal.h"
+#include "../UI/InputSource.h"
+#include "../UI/Animation.h"
 #include <iostream>
-#include <thread>
 #include <chrono>
 
 /**
@@ -35,7 +36,7 @@ void SpecialFunctions::showWeaponInfo() {
     }
     UI::DisplayCenterText("Press w to return...", 26);
     while (true) {
-        int ch = getchar();
+        int ch = InputSource::Get().ReadChar();
         if (ch == 'w' || ch == 'W') {
             break;
         }
@@ -68,7 +69,7 @@ void SpecialFunctions::showPlayerInfo(const WeekCycle& weekCycle, const Player&
     UI::DisplayCenterText("Press l to return...", 25);
     
     while (true) {
-        int ch = getchar();
+        int ch = InputSource::Get().ReadChar();
         if (ch == 'l' || ch == 'L') {
             break;
         }
@@ -91,7 +92,7 @@ void SpecialFunctions::showQuitMessage() {
     UI::DisplayCenterText("Press any other key to return", 21);
     
     while (true) {
-        int ch = getchar();
+        int ch = InputSource::Get().ReadChar();
         if (ch == 'q' || ch == 'Q') {
             UI::ShowInterface("ui/empty.txt");
             UI::DisplayCenterText("Thank you for playing!", 15);
@@ -99,11 +100,11 @@ void SpecialFunctions::showQuitMessage() {
             std::cout << std::flush;  // Ensure text is displayed immediately
 
             // Increase display time to 3 seconds
-            std::this_thread::sleep_for(std::chrono::milliseconds(1500));
+            Animation::Pause(std::chrono::milliseconds(1500));
             
             // Show cursor before clearing screen
             Terminal::GetInstance().ShowCursor();
-            std::this_thread::sleep_for(std::chrono::milliseconds(500));
+            Animation::Pause(std::chrono::milliseconds(500));
             Terminal::GetInstance().Clear();
             exit(0);  // Exit game directly
         } else {
@@ -126,7 +127,7 @@ bool SpecialFunctions::showPauseScreen() {
     UI::DisplayCenterText("Press p to continue", 20);
     
     while (true) {
-        int ch = getchar();
+        int ch = InputSource::Get().ReadChar();
         if (ch == 'p' || ch == 'P') {
             return true;  // Return true to continue game
         }
@@ -0,0 +1,75 @@
+/**
+ * @file SpscQueue.h
+ * @brief Fixed-size lock-free queue between one producer and one consumer
+ *
+ * This file defines the SpscQueue class template, a ring buffer that one
+ * thread pushes into while another pops from it, without locks:
+ * - Each side owns one index and only reads the other's
+ * - Indices count up forever and are masked into the buffer, so a full
+ *   queue and an empty one are told apart without a spare slot
+ * - The indices sit on separate cache lines so the two threads do not
+ *   invalidate each other's line on every operation
+ *
+ * @see KeyReader
+ */
+
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+/**
+ * @class SpscQueue
+ * @brief Bounded single-producer/single-consumer ring buffer
+ * @tparam T Element type, copied in and out
+ * @tparam Capacity Number of slots, a power of two
+ */
+template <typename T, size_t Capacity>
+class SpscQueue {
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0,
+                  "SpscQueue capacity must be a power of two");
+
+public:
+    /**
+     * @brief Appends an element; producer thread only
+     * @param value Element to append
+     * @return bool False if the queue was full and the element was dropped
+     */
+    bool TryPush(const T& value) {
+        size_t tail = writeIndex.load(std::memory_order_relaxed);
+        if (tail - readIndex.load(std::memory_order_acquire) == Capacity) {
+            return false;
+        }
+        slots[tail & (Capacity - 1)] = value;
+        writeIndex.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Removes the oldest element; consumer thread only
+     * @param value Receives the element
+     * @return bool False if the queue was empty
+     */
+    bool TryPop(T& value) {
+        size_t head = readIndex.load(std::memory_order_relaxed);
+        if (head == writeIndex.load(std::memory_order_acquire)) {
+            return false;
+        }
+        value = slots[head & (Capacity - 1)];
+        readIndex.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Checks for elements; consumer thread only
+     * @return bool True if nothing is queued
+     */
+    bool Empty() const {
+        return readIndex.load(std::memory_order_relaxed) == writeIndex.load(std::memory_order_acquire);
+    }
+
+private:
+    std::array<T, Capacity> slots{};              ///< Ring storage
+    alignas(64) std::atomic<size_t> readIndex{0};  ///< Next slot to pop, written by the consumer
+    alignas(64) std::atomic<size_t> writeIndex{0}; ///< Next slot to push, written by the producer
+};
@@ -12,16 +12,96 @@
  * 
  * @see Game
  * @see Terminal
+ * @see AssetCache
  * @see Random
+ * @see InputSource
+ * @see Clock
  */
 
 #include "Core/Game.h"
 #include "UI/Terminal.h"
+#include "UI/AssetCache.h"
+#include "UI/InputSource.h"
+#include "UI/Animation.h"
 #include "Utils/Random.h"
+#include "Utils/Clock.h"
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
 #include <iostream>
-#include <thread>
+#include <memory>
+#include <string>
 #include <chrono>
 
+/**
+ * @brief Reads the value of an option given as "--name value" or "--name=value"
+ * @param argc Argument count
+ * @param argv Argument values
+ * @param i Index of the current argument; advanced past a separate value
+ * @param name Option name including the leading dashes
+ * @param value Set to the option value if the argument matches
+ * @return bool True if the current argument is this option
+ */
+static bool MatchOption(int argc, char* argv[], int& i, const std::string& name, std::string& value) {
+    std::string arg = argv[i];
+    if (arg == name && i + 1 < argc) {
+        value = argv[++i];
+        return true;
+    }
+    if (arg.rfind(name + "=", 0) == 0) {
+        value = arg.substr(name.size() + 1);
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Applies the command-line options
+ * 
+ * Supported options:
+ * - --seed N (or --seed=N): seeds the random streams for a reproducible run
+ * - --script FILE (or --script=FILE): reads keys from FILE instead of the
+ *   keyboard and runs on a virtual clock, so the run finishes without delays
+ * - --speed N (or --speed=N): runs animations and cosmetic pauses N times
+ *   as fast; 0 makes them instant, other values must be at least
+ *   Animation::MIN_SPEED
+ * 
+ * @param argc Argument count
+ * @param argv Argument values
+ * @param scriptPath Set to the input script path, if one is given
+ * @return bool False if an option is unknown or malformed
+ */
+static bool ParseArguments(int argc, char* argv[], std::string& scriptPath) {
+    for (int i = 1; i < argc; i++) {
+        std::string value;
+        char* end = nullptr;
+        if (MatchOption(argc, argv, i, "--script", value)) {
+            scriptPath = value;
+        } else if (MatchOption(argc, argv, i, "--seed", value)) {
+            // strtoull would wrap a leading '-' around instead of failing
+            errno = 0;
+            unsigned long long seed = std::strtoull(value.c_str(), &end, 10);
+            if (value.empty() || !std::isdigit(static_cast<unsigned char>(value[0])) ||
+                *end != '\0' || errno == ERANGE) {
+                std::cerr << "Invalid seed: " << value << std::endl;
+                return false;
+            }
+            Random::Seed(seed);
+        } else if (MatchOption(argc, argv, i, "--speed", value)) {
+            double speed = std::strtod(value.c_str(), &end);
+            if (value.empty() || *end != '\0' || !(speed == 0.0 || speed >= Animation::MIN_SPEED)) {
+                std::cerr << "Invalid speed: " << value << std::endl;
+                return false;
+            }
+            Animation::SetSpeed(speed);
+        } else {
+            std::cerr << "Unknown option: " << argv[i] << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
 /**
  * @brief Main entry point for the game
  * 
@@ -29,26 +109,62 @@
  * Manages terminal display settings (cursor visibility) and ensures proper cleanup.
  * 
  * The function performs the following operations in sequence:
- * 1. Hides the terminal cursor for better game display
- * 2. Initializes and runs the main game
- * 3. Handles any exceptions that occur during gameplay
- * 4. Ensures the cursor is restored before program exit
+ * 1. Applies command-line options such as --seed, --speed and --script
+ * 2. Hides the terminal cursor for better game display
+ * 3. Preloads all UI and animation assets so no disk I/O happens during play
+ * 4. Initializes and runs the main game
+ * 5. Handles any exceptions that occur during gameplay
+ * 6. Ensures the cursor is restored before program exit
  * 
+ * @param argc Argument count
+ * @param argv Argument values
  * @throws std::exception Any exception thrown during game execution
  * @return int Returns 0 on successful execution, non-zero on failure
  */
-int main() {
+int main(int argc, char* argv[]) {
+    std::string scriptPath;
+    if (!ParseArguments(argc, argv, scriptPath)) {
+        std::cerr << "Usage: " << argv[0] << " [--seed N] [--speed N] [--script FILE]" << std::endl;
+        return 1;
+    }
+
+    // A scripted run takes its keys from the file and never waits
+    std::unique_ptr<ScriptInput> script;
+    VirtualClock virtualClock;
+    if (!scriptPath.empty()) {
+        try {
+            script = std::make_unique<ScriptInput>(scriptPath);
+        } catch (const std::exception& e) {
+            std::cerr << e.what() << std::endl;
+            return 1;
+        }
+        InputSource::Set(script.get());
+        Clock::Set(&virtualClock);
+    }
+
     // Hide cursor for better game display
     Terminal::GetInstance().HideCursor();
 
     try {
+        AssetCache::GetInstance().Preload("ui");
+        AssetCache::GetInstance().Preload("anim");
+
         Game game;
         game.run();
+    } catch (const InputClosedException&) {
+        // The script (or standard input) ran out before the game ended
+        Terminal::GetInstance().ShowCursor();
+        Terminal::GetInstance().LeaveAlternateScreen();
+        std::cerr << std::endl << "Input ended before the game finished" << std::endl;
+        return 1;
     } catch (const std::exception& e) {
         Terminal::GetInstance().Clear();
         Terminal::GetInstance().MoveCursor(10, 10);
         std::cerr << "Game crashed: " << e.what();
-        std::this_thread::sleep_for(std::chrono::seconds(5));
+        Clock::Get().SleepFor(std::chrono::seconds(5));
+        // Repeat the message where it stays visible after exit
+        Terminal::GetInstance().LeaveAlternateScreen();
+        std::cerr << std::endl << "Game crashed: " << e.what() << std::endl;
     }
 
     // Restore cursor visibility before exit
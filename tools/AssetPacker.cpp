@@ -0,0 +1,271 @@
+/**
+ * @file AssetPacker.cpp
+ * @brief Build-time tool that packs the game's text assets into one bundle
+ * 
+ * Walks the given asset directories (normally ui and anim), collects every
+ * .txt file and writes them into a single indexed bundle file in the
+ * format described in AssetBundle.h. The build runs it whenever an asset
+ * changes; the game maps the result instead of opening hundreds of files.
+ * 
+ * With --cpp it instead writes a C++ header holding the assets as
+ * constexpr data, which the EMBED_ASSETS build compiles into the game.
+ * 
+ * Usage: asset_packer [--cpp] <output file> <asset dir>...
+ * Asset directories are given relative to the working directory, and the
+ * packed paths keep that form (e.g. "ui/Home/home_shop.txt").
+ * 
+ * @see AssetBundle
+ * @see EmbeddedAssets
+ */
+
+#include "UI/AssetBundle.h"
+#include "UI/EmbeddedAssets.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include <dirent.h>
+#include <sys/stat.h>
+
+/**
+ * @brief Recursively collects the .txt files below a directory
+ * @param dirPath Directory to walk
+ * @param files Receives the paths of the files found
+ * @return bool False if a directory could not be opened
+ */
+static bool CollectFiles(const std::string& dirPath, std::vector<std::string>& files) {
+    DIR* dir = opendir(dirPath.c_str());
+    if (!dir) {
+        std::cerr << "Cannot open asset directory: " << dirPath << std::endl;
+        return false;
+    }
+
+    std::vector<std::string> names;
+    struct dirent* entry;
+    while ((entry = readdir(dir)) != nullptr) {
+        if (entry->d_name[0] != '.') {
+            names.emplace_back(entry->d_name);
+        }
+    }
+    closedir(dir);
+
+    for (const auto& name : names) {
+        std::string path = dirPath + "/" + name;
+        struct stat info;
+        if (stat(path.c_str(), &info) != 0) {
+            continue;
+        }
+        if (S_ISDIR(info.st_mode)) {
+            if (!CollectFiles(path, files)) {
+                return false;
+            }
+        } else if (name.size() > 4 && name.compare(name.size() - 4, 4, ".txt") == 0) {
+            files.push_back(path);
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Writes the assets as a binary bundle
+ * @param outputPath Path of the bundle file to create
+ * @param paths Asset paths, sorted
+ * @param contents Contents of each asset, in the same order
+ * @return bool False if the bundle could not be written
+ */
+static bool WriteBundle(const char* outputPath, const std::vector<std::string>& paths,
+                        const std::vector<std::string>& contents) {
+    // Lay out header, index, then all paths, then all contents
+    AssetBundleFormat::Header header;
+    std::memcpy(header.magic, AssetBundleFormat::MAGIC, sizeof(header.magic));
+    header.version = AssetBundleFormat::VERSION;
+    header.count = static_cast<uint32_t>(paths.size());
+    header.reserved = 0;
+
+    std::vector<AssetBundleFormat::Entry> entries(paths.size());
+    size_t offset = sizeof(header) + entries.size() * sizeof(AssetBundleFormat::Entry);
+    for (size_t i = 0; i < paths.size(); i++) {
+        entries[i].pathOffset = static_cast<uint32_t>(offset);
+        entries[i].pathLength = static_cast<uint32_t>(paths[i].size());
+        offset += paths[i].size();
+    }
+    for (size_t i = 0; i < contents.size(); i++) {
+        entries[i].dataOffset = static_cast<uint32_t>(offset);
+        entries[i].dataLength = static_cast<uint32_t>(contents[i].size());
+        offset += contents[i].size();
+    }
+    if (offset > UINT32_MAX) {
+        std::cerr << "Assets too large for bundle format" << std::endl;
+        return false;
+    }
+
+    std::ofstream output(outputPath, std::ios::binary | std::ios::trunc);
+    if (!output.is_open()) {
+        std::cerr << "Failed to create bundle: " << outputPath << std::endl;
+        return false;
+    }
+    output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    output.write(reinterpret_cast<const char*>(entries.data()),
+                 static_cast<std::streamsize>(entries.size() * sizeof(AssetBundleFormat::Entry)));
+    for (const auto& path : paths) {
+        output.write(path.data(), static_cast<std::streamsize>(path.size()));
+    }
+    for (const auto& data : contents) {
+        output.write(data.data(), static_cast<std::streamsize>(data.size()));
+    }
+    if (!output) {
+        std::cerr << "Failed to write bundle: " << outputPath << std::endl;
+        return false;
+    }
+
+    std::cout << "Packed " << paths.size() << " assets (" << offset << " bytes) into " << outputPath << std::endl;
+    return true;
+}
+
+/**
+ * @brief Appends text as the body of a C++ string literal
+ * 
+ * Bytes outside printable ASCII are written as three-digit octal escapes,
+ * which cannot run into a following digit. The literal is split after each
+ * newline to keep the generated lines short.
+ * @param out Receives the escaped text
+ * @param text Text to escape
+ */
+static void AppendStringLiteral(std::string& out, const std::string& text) {
+    static const char DIGITS[] = "01234567";
+
+    out += "\n        \"";
+    for (size_t i = 0; i < text.size(); i++) {
+        unsigned char ch = static_cast<unsigned char>(text[i]);
+        if (ch == '\\' || ch == '"') {
+            out += '\\';
+            out += static_cast<char>(ch);
+        } else if (ch == '\n') {
+            out += "\\n";
+            if (i + 1 < text.size()) {
+                out += "\"\n        \"";
+            }
+        } else if (ch < 0x20 || ch >= 0x7F || ch == '?') {
+            out += '\\';
+            out += DIGITS[(ch >> 6) & 7];
+            out += DIGITS[(ch >> 3) & 7];
+            out += DIGITS[ch & 7];
+        } else {
+            out += static_cast<char>(ch);
+        }
+    }
+    out += '"';
+}
+
+/**
+ * @brief Writes the assets as a C++ header of constexpr data
+ * 
+ * Each file becomes a character array, and EmbeddedAssets::TABLE lists
+ * them sorted by path hash. The hashes are spelled as HashPath calls so
+ * the compiler computes them; EmbeddedAssets.cpp checks the order.
+ * @param outputPath Path of the header to create
+ * @param paths Asset paths, sorted
+ * @param contents Contents of each asset, in the same order
+ * @return bool False if the header could not be written
+ */
+static bool WriteSource(const char* outputPath, const std::vector<std::string>& paths,
+                        const std::vector<std::string>& contents) {
+    std::vector<size_t> order(paths.size());
+    for (size_t i = 0; i < order.size(); i++) {
+        order[i] = i;
+    }
+    std::sort(order.begin(), order.end(), [&paths](size_t a, size_t b) {
+        return EmbeddedAssets::HashPath(paths[a]) < EmbeddedAssets::HashPath(paths[b]);
+    });
+    for (size_t i = 1; i < order.size(); i++) {
+        if (EmbeddedAssets::HashPath(paths[order[i - 1]]) == EmbeddedAssets::HashPath(paths[order[i]])) {
+            std::cerr << "Asset path hash collision: " << paths[order[i - 1]] << ", " << paths[order[i]] << std::endl;
+            return false;
+        }
+    }
+
+    std::string source;
+    source += "// Generated by asset_packer --cpp. Do not edit.\n";
+    source += "#pragma once\n";
+    source += "#include \"UI/EmbeddedAssets.h\"\n";
+    source += "#include <array>\n\n";
+    source += "namespace EmbeddedAssets {\nnamespace Data {\n";
+    for (size_t i = 0; i < paths.size(); i++) {
+        source += "    // " + paths[i] + "\n";
+        source += "    constexpr char FILE_" + std::to_string(i) + "[] =";
+        AppendStringLiteral(source, contents[i]);
+        source += ";\n";
+    }
+    source += "}\n\n";
+
+    source += "constexpr std::array<Asset, " + std::to_string(paths.size()) + "> TABLE{{\n";
+    for (size_t i : order) {
+        std::string file = "Data::FILE_" + std::to_string(i);
+        source += "    {HashPath(\"" + paths[i] + "\"), \"" + paths[i] + "\", std::string_view(" +
+                  file + ", sizeof(" + file + ") - 1)},\n";
+    }
+    source += "}};\n}\n";
+
+    std::ofstream output(outputPath, std::ios::binary | std::ios::trunc);
+    if (!output.is_open()) {
+        std::cerr << "Failed to create source: " << outputPath << std::endl;
+        return false;
+    }
+    output.write(source.data(), static_cast<std::streamsize>(source.size()));
+    if (!output) {
+        std::cerr << "Failed to write source: " << outputPath << std::endl;
+        return false;
+    }
+
+    std::cout << "Embedded " << paths.size() << " assets into " << outputPath << std::endl;
+    return true;
+}
+
+/**
+ * @brief Entry point of the asset packer
+ * @param argc Argument count
+ * @param argv Optional --cpp, then the output file and the asset directories
+ * @return int 0 on success, 1 on failure
+ */
+int main(int argc, char* argv[]) {
+    bool generateSource = argc > 1 && std::strcmp(argv[1], "--cpp") == 0;
+    int first = generateSource ? 2 : 1;
+    if (argc < first + 2) {
+        std::cerr << "Usage: " << argv[0] << " [--cpp] <output file> <asset dir>..." << std::endl;
+        return 1;
+    }
+    const char* outputPath = argv[first];
+
+    std::vector<std::string> paths;
+    for (int i = first + 1; i < argc; i++) {
+        std::string dirPath = argv[i];
+        while (dirPath.size() > 1 && dirPath.back() == '/') {
+            dirPath.pop_back();
+        }
+        if (!CollectFiles(dirPath, paths)) {
+            return 1;
+        }
+    }
+    std::sort(paths.begin(), paths.end());
+
+    // Read every file; the index must be sorted by path for binary search
+    std::vector<std::string> contents;
+    for (const auto& path : paths) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open()) {
+            std::cerr << "Failed to open asset file: " << path << std::endl;
+            return 1;
+        }
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        contents.push_back(buffer.str());
+    }
+
+    bool written = generateSource ? WriteSource(outputPath, paths, contents)
+                                  : WriteBundle(outputPath, paths, contents);
+    return written ? 0 : 1;
+}
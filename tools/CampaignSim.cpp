@@ -0,0 +1,422 @@
+/**
+ * @file CampaignSim.cpp
+ * @brief Monte Carlo balance runner over the full 25-day campaign
+ *
+ * Plays many headless games per difficulty with one of the built-in
+ * strategies and reports how the campaigns ended: win rate, cause of
+ * defeat and the week in which lost games ended. Games are spread over
+ * all cores; every game is seeded from the run seed, its difficulty and
+ * its index, so the report does not depend on the number of threads.
+ *
+ * Usage: campaign_sim [--games N] [--threads N] [--seed N] [--strategy NAME]
+ *                     [--actions-per-second N] [--reaction-ms N]
+ * Strategies: balanced (default), miner, explorer
+ * The combat bot acts at most 20 times a second with a 200 ms reaction
+ * time by default, about what a held key and a quick player manage.
+ * --threads defaults to the hardware threads and may be at most four
+ * times that; runs never use more threads than games.
+ *
+ * @see CampaignSim
+ * @see CombatSim
+ */
+
+#include "Core/CampaignSim.h"
+#include "Core/Difficulty.h"
+#include "Counters/Recruit.h"
+#include "Utils/Constants.h"
+#include "Utils/Random.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cctype>
+#include <cerrno>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+/// Difficulty presets reported, in order
+static const char* const DIFFICULTIES[] = {"EASY", "MEDIUM", "HARD"};
+static const int DIFFICULTY_COUNT = 3;
+
+/**
+ * @brief How fast the combat bot plays, in simulation ticks
+ */
+struct Reflexes {
+    int actionIntervalTicks;  ///< Ticks between two actions
+    int reactionTicks;        ///< Ticks before a zombie's position reaches the bot
+};
+
+/**
+ * @brief Strategy base with a shared combat bot
+ *
+ * In combat the bot walks toward the zombie closest to the bottom of the
+ * arena and fires once the zombie is within its weapon's spread. To play
+ * like a person at the keyboard rather than a frame-perfect script, it
+ * sees the zombies a reaction time late and acts at most at the rate of
+ * a held key.
+ */
+class BotStrategy : public CampaignStrategy {
+public:
+    explicit BotStrategy(const Reflexes& reflexes) : reflexes(reflexes) {}
+
+    CombatAction chooseCombatAction(const CombatSim& sim) override {
+        if (sim.getElapsedTicks() == 0) {
+            seenTargets.clear();
+        }
+        seenTargets.push_back(FindTarget(sim));
+        if (seenTargets.size() <= static_cast<size_t>(reflexes.reactionTicks)) {
+            return CombatAction::NONE;
+        }
+        Target target = seenTargets.front();
+        seenTargets.pop_front();
+        if (target.y < 0 || sim.getElapsedTicks() % reflexes.actionIntervalTicks != 0) {
+            return CombatAction::NONE;
+        }
+
+        int dx = target.x - sim.getPlayerX();
+        if (std::abs(dx) <= (sim.getWeapon().getMultiple() - 1) / 2) {
+            return CombatAction::SHOOT;
+        } else if (dx <= -3) {
+            return CombatAction::DASH_LEFT;
+        } else if (dx >= 3) {
+            return CombatAction::DASH_RIGHT;
+        }
+        return dx < 0 ? CombatAction::MOVE_LEFT : CombatAction::MOVE_RIGHT;
+    }
+
+protected:
+    /**
+     * @brief Farmers needed to keep enough crops for the next few days
+     * @param player Current player state
+     * @param days Days of food to keep in stock
+     * @return int Workers to send farming, at most the available people
+     */
+    static int FarmersNeeded(const Player& player, int days) {
+        int yield = Difficulty::GetConfig(player.getStringDifficulty()).cropYield;
+        int shortfall = player.getPeople() * GameConfig::FOOD_PER_PERSON * days - player.getCrop();
+        if (shortfall <= 0) {
+            return 0;
+        }
+        return std::min(player.getAvailablePeople(), (shortfall + yield - 1) / yield);
+    }
+
+    /**
+     * @brief Checks whether the next weapon upgrade is affordable
+     * @param player Current player state
+     * @return bool True if the shop would upgrade the weapon
+     */
+    static bool CanUpgrade(const Player& player) {
+        int level = player.getWeaponLevel();
+        return level < 10 && player.getGold() >= Player::WEAPON_UPGRADE_COST.at(level);
+    }
+
+private:
+    /**
+     * @brief Zombie the bot is going for; y is -1 when there is none
+     */
+    struct Target {
+        int x;
+        int y;
+    };
+
+    Reflexes reflexes;               ///< Reaction time and action rate
+    std::deque<Target> seenTargets;  ///< Targets of the last ticks, oldest first
+
+    /**
+     * @brief Picks the zombie closest to the bottom, nearest the player on ties
+     * @param sim Current state of the wave
+     * @return Target The zombie's position, y = -1 if none is left
+     */
+    static Target FindTarget(const CombatSim& sim) {
+        const ZombieManager& zombies = sim.getZombies();
+        int playerX = sim.getPlayerX();
+        Target target{-1, -1};
+        for (int i = 0; i < zombies.getCount(); i++) {
+            Zombie zombie = zombies.getZombie(i);
+            if (zombie.y > target.y ||
+                (zombie.y == target.y && std::abs(zombie.x - playerX) < std::abs(target.x - playerX))) {
+                target = Target{zombie.x, zombie.y};
+            }
+        }
+        return target;
+    }
+};
+
+/**
+ * @brief Keeps two days of food, upgrades, recruits with spare crops, mines
+ */
+class BalancedStrategy : public BotStrategy {
+public:
+    using BotStrategy::BotStrategy;
+
+    CampaignAction chooseAction(const Player& player, const WeekCycle&) override {
+        if (int farmers = FarmersNeeded(player, 2)) {
+            return {CounterType::FARMING, farmers};
+        }
+        if (CanUpgrade(player)) {
+            return {CounterType::SHOP, 1};
+        }
+        int reserve = player.getPeople() * GameConfig::FOOD_PER_PERSON * 2;
+        int recruits = std::min(2, (player.getCrop() - reserve) / RecruitCounter::COST_PER_MEMBER);
+        if (recruits > 0 && player.getAvailablePeople() > 1) {
+            return {CounterType::RECRUIT, recruits};
+        }
+        return {CounterType::MINING, player.getAvailablePeople()};
+    }
+};
+
+/**
+ * @brief Keeps one day of food, upgrades whenever possible, mines
+ */
+class MinerStrategy : public BotStrategy {
+public:
+    using BotStrategy::BotStrategy;
+
+    CampaignAction chooseAction(const Player& player, const WeekCycle&) override {
+        if (int farmers = FarmersNeeded(player, 1)) {
+            return {CounterType::FARMING, farmers};
+        }
+        if (CanUpgrade(player)) {
+            return {CounterType::SHOP, 1};
+        }
+        return {CounterType::MINING, player.getAvailablePeople()};
+    }
+};
+
+/**
+ * @brief Keeps one day of food, upgrades whenever possible, explores
+ */
+class ExplorerStrategy : public BotStrategy {
+public:
+    using BotStrategy::BotStrategy;
+
+    CampaignAction chooseAction(const Player& player, const WeekCycle&) override {
+        if (int farmers = FarmersNeeded(player, 1)) {
+            return {CounterType::FARMING, farmers};
+        }
+        if (CanUpgrade(player)) {
+            return {CounterType::SHOP, 1};
+        }
+        return {CounterType::EXPLORE, player.getAvailablePeople()};
+    }
+};
+
+/**
+ * @brief Creates a strategy by name
+ * @param name Strategy name
+ * @param reflexes Speed of its combat bot
+ * @return std::unique_ptr<CampaignStrategy> The strategy, or nullptr if unknown
+ */
+static std::unique_ptr<CampaignStrategy> CreateStrategy(const std::string& name, const Reflexes& reflexes) {
+    if (name == "balanced") return std::make_unique<BalancedStrategy>(reflexes);
+    if (name == "miner") return std::make_unique<MinerStrategy>(reflexes);
+    if (name == "explorer") return std::make_unique<ExplorerStrategy>(reflexes);
+    return nullptr;
+}
+
+/**
+ * @brief Outcome counts of the games played for one difficulty
+ */
+struct Tally {
+    long long games = 0;
+    std::array<long long, 3> outcomes{};                          ///< Indexed by CampaignOutcome
+    std::array<long long, GameConfig::TOTAL_WEEKS + 1> lostInWeek{};  ///< Defeats by week (1-5)
+    long long weaponLevelSum = 0;
+
+    /**
+     * @brief Adds the result of one game
+     * @param result Result to add
+     */
+    void Add(const CampaignResult& result) {
+        games++;
+        outcomes[static_cast<int>(result.outcome)]++;
+        if (result.outcome != CampaignOutcome::VICTORY) {
+            lostInWeek[(result.day - 1) / GameConfig::DAYS_PER_WEEK + 1]++;
+        }
+        weaponLevelSum += result.weaponLevel;
+    }
+
+    /**
+     * @brief Adds the counts of another tally
+     * @param other Tally to merge in
+     */
+    void Merge(const Tally& other) {
+        games += other.games;
+        for (size_t i = 0; i < outcomes.size(); i++) outcomes[i] += other.outcomes[i];
+        for (size_t i = 0; i < lostInWeek.size(); i++) lostInWeek[i] += other.lostInWeek[i];
+        weaponLevelSum += other.weaponLevelSum;
+    }
+};
+
+/**
+ * @brief Derives the seed of one game
+ * @param seed Run seed
+ * @param difficulty Difficulty index
+ * @param game Game index within the difficulty
+ * @return uint64_t Well-mixed seed (splitmix64 finalizer)
+ */
+static uint64_t GameSeed(uint64_t seed, int difficulty, long long game) {
+    uint64_t z = seed ^ (static_cast<uint64_t>(difficulty) << 56) ^ static_cast<uint64_t>(game);
+    z += 0x9E3779B97F4A7C15ull;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+/**
+ * @brief Formats a share of the games as a percentage
+ * @param count Number of games
+ * @param total Total number of games
+ * @return std::string Percentage with two decimals
+ */
+static std::string Percent(long long count, long long total) {
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(2) << (total > 0 ? 100.0 * count / total : 0.0) << "%";
+    return out.str();
+}
+
+/**
+ * @brief Prints the report for one difficulty
+ * @param name Difficulty name
+ * @param tally Outcomes of its games
+ */
+static void PrintTally(const char* name, const Tally& tally) {
+    long long wins = tally.outcomes[static_cast<int>(CampaignOutcome::VICTORY)];
+    double p = tally.games > 0 ? static_cast<double>(wins) / tally.games : 0.0;
+    double margin = tally.games > 0 ? 196.0 * std::sqrt(p * (1.0 - p) / tally.games) : 0.0;
+
+    std::cout << std::left << std::setw(8) << name
+              << "win " << Percent(wins, tally.games)
+              << " (+/-" << std::fixed << std::setprecision(2) << margin << ")"
+              << " | no people " << Percent(tally.outcomes[static_cast<int>(CampaignOutcome::NO_PEOPLE)], tally.games)
+              << " | combat lost " << Percent(tally.outcomes[static_cast<int>(CampaignOutcome::COMBAT_LOST)], tally.games)
+              << " | mean weapon Lv." << std::setprecision(2)
+              << (tally.games > 0 ? static_cast<double>(tally.weaponLevelSum) / tally.games : 0.0) << std::endl;
+
+    std::cout << "        defeats by week:";
+    for (int week = 1; week <= GameConfig::TOTAL_WEEKS; week++) {
+        std::cout << "  " << week << ": " << Percent(tally.lostInWeek[week], tally.games);
+    }
+    std::cout << std::endl;
+}
+
+/// Most worker threads allowed per hardware thread
+static constexpr unsigned long long THREADS_PER_CORE = 4;
+
+/**
+ * @brief Parses an unsigned decimal option value
+ * @param text Option value
+ * @param value Set to the parsed value
+ * @return bool False if the text is not a number or out of range
+ */
+static bool ParseNumber(const char* text, unsigned long long& value) {
+    // strtoull would wrap a leading '-' around instead of failing
+    if (!std::isdigit(static_cast<unsigned char>(*text))) {
+        return false;
+    }
+    char* end = nullptr;
+    errno = 0;
+    value = std::strtoull(text, &end, 10);
+    return *end == '\0' && errno != ERANGE;
+}
+
+/**
+ * @brief Prints the accepted options
+ * @param program Name the runner was started as
+ */
+static void PrintUsage(const char* program) {
+    std::cerr << "Usage: " << program
+              << " [--games N] [--threads N] [--seed N] [--strategy balanced|miner|explorer]"
+              << " [--actions-per-second N] [--reaction-ms N]" << std::endl;
+}
+
+/**
+ * @brief Entry point of the balance runner
+ * @param argc Argument count
+ * @param argv Options, see the file description
+ * @return int 0 on success, 1 on bad arguments
+ */
+int main(int argc, char* argv[]) {
+    unsigned long long games = 10000;
+    unsigned long long cores = std::max(1u, std::thread::hardware_concurrency());
+    unsigned long long threads = cores;
+    unsigned long long seed = 1;
+    std::string strategyName = "balanced";
+    unsigned long long actionsPerSecond = 20;
+    unsigned long long reactionMs = 200;
+
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = i + 1 < argc;
+        bool valid = hasValue;
+        if (std::strcmp(argv[i], "--games") == 0 && hasValue) {
+            valid = ParseNumber(argv[++i], games);
+        } else if (std::strcmp(argv[i], "--threads") == 0 && hasValue) {
+            valid = ParseNumber(argv[++i], threads) && threads > 0 && threads <= cores * THREADS_PER_CORE;
+        } else if (std::strcmp(argv[i], "--seed") == 0 && hasValue) {
+            valid = ParseNumber(argv[++i], seed);
+        } else if (std::strcmp(argv[i], "--strategy") == 0 && hasValue) {
+            strategyName = argv[++i];
+            valid = CreateStrategy(strategyName, Reflexes{1, 0}) != nullptr;
+        } else if (std::strcmp(argv[i], "--actions-per-second") == 0 && hasValue) {
+            valid = ParseNumber(argv[++i], actionsPerSecond) && actionsPerSecond > 0 &&
+                    actionsPerSecond <= CombatSim::TICKS_PER_SECOND;
+        } else if (std::strcmp(argv[i], "--reaction-ms") == 0 && hasValue) {
+            valid = ParseNumber(argv[++i], reactionMs) && reactionMs <= 10000;
+        } else {
+            valid = false;
+        }
+        if (!valid) {
+            PrintUsage(argv[0]);
+            return 1;
+        }
+    }
+    // A worker without a game of its own would only cost a thread
+    threads = std::max(1ull, std::min(threads, games));
+    Reflexes reflexes{static_cast<int>(CombatSim::TICKS_PER_SECOND / actionsPerSecond),
+                      static_cast<int>(reactionMs * CombatSim::TICKS_PER_SECOND / 1000)};
+
+    // Each worker plays every threads-th game of each difficulty
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::array<Tally, DIFFICULTY_COUNT>> tallies(threads);
+    std::vector<std::thread> workers;
+    for (unsigned long long worker = 0; worker < threads; worker++) {
+        workers.emplace_back([&, worker] {
+            auto strategy = CreateStrategy(strategyName, reflexes);
+            for (int difficulty = 0; difficulty < DIFFICULTY_COUNT; difficulty++) {
+                for (unsigned long long game = worker; game < games; game += threads) {
+                    Random::Seed(GameSeed(seed, difficulty, static_cast<long long>(game)));
+                    CampaignSim sim(DIFFICULTIES[difficulty], *strategy);
+                    tallies[worker][difficulty].Add(sim.run());
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "Strategy: " << strategyName << ", " << games << " games per difficulty, "
+              << threads << " threads, seed " << seed << std::endl;
+    std::cout << "Combat bot: one action every " << reflexes.actionIntervalTicks << " ticks, "
+              << reactionMs << " ms reaction" << std::endl;
+    for (int difficulty = 0; difficulty < DIFFICULTY_COUNT; difficulty++) {
+        Tally total;
+        for (const auto& tally : tallies) {
+            total.Merge(tally[difficulty]);
+        }
+        PrintTally(DIFFICULTIES[difficulty], total);
+    }
+    std::cout << "Played " << games * DIFFICULTY_COUNT << " games in " << std::fixed << std::setprecision(2)
+              << seconds << " s" << std::endl;
+    return 0;
+}